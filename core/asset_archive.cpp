@@ -0,0 +1,104 @@
+#include "asset_archive.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include "binary_io.h"
+
+using namespace BinaryIO;
+
+namespace {
+    const char MAGIC[4] = { 'S', 'D', 'A', 'R' };
+    const uint16_t VERSION = 2; // 2 added the content hash
+    const size_t DATA_ALIGNMENT = 16;
+}
+
+AssetArchive& AssetArchive::getInstance() {
+    static AssetArchive instance;
+    return instance;
+}
+
+bool AssetArchive::open(const std::string& path) {
+    close();
+    std::error_code error;
+    if (!std::filesystem::exists(path, error)) return false; // not packed: loose files it is
+    if (!m_file.open(path)) return false;
+
+    Reader in{ m_file.getData(), m_file.getSize() };
+    std::string magic = in.str(sizeof(MAGIC));
+    bool valid = in.ok && std::equal(std::begin(MAGIC), std::end(MAGIC), magic.begin()) && in.u16() == VERSION;
+    uint32_t count = valid ? in.u32() : 0;
+
+    for (uint32_t i = 0; valid && i < count; ++i) {
+        std::string file = in.string();
+        uint64_t offset = in.u64();
+        uint64_t bytes = in.u64();
+        uint64_t hash = in.u64();
+        if (!in.ok || offset > m_file.getSize() || bytes > m_file.getSize() - offset) {
+            valid = false;
+            break;
+        }
+        m_entries[file] = { m_file.getData() + offset, static_cast<size_t>(bytes), hash };
+    }
+    if (!valid) {
+        SDL_Log("AssetArchive: '%s' is not a valid archive, reading loose files.", path.c_str());
+        close();
+        return false;
+    }
+    SDL_Log("AssetArchive: Mapped %zu files from '%s'.", m_entries.size(), path.c_str());
+    return true;
+}
+
+void AssetArchive::close() {
+    m_entries.clear();
+    m_file.close();
+}
+
+SDL_IOStream* AssetArchive::openFile(const std::string& path) const {
+    auto it = m_entries.find(path);
+    if (it != m_entries.end()) return SDL_IOFromConstMem(it->second.data, it->second.bytes);
+    return SDL_IOFromFile(path.c_str(), "rb");
+}
+
+bool AssetArchive::getFileInfo(const std::string& path, uint64_t& bytes, uint64_t& hash) const {
+    auto it = m_entries.find(path);
+    if (it == m_entries.end()) return false;
+    bytes = it->second.bytes;
+    hash = it->second.hash;
+    return true;
+}
+
+bool AssetArchive::write(const std::string& path, const std::vector<std::string>& files) {
+    std::vector<std::vector<char>> contents(files.size());
+    for (size_t i = 0; i < files.size(); ++i) {
+        std::ifstream in(files[i], std::ios::binary);
+        if (!in.is_open()) {
+            SDL_Log("AssetArchive: Failed to open '%s'", files[i].c_str());
+            return false;
+        }
+        contents[i].assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+
+    // header and index first, to know where the data starts
+    std::vector<uint8_t> header;
+    header.insert(header.end(), std::begin(MAGIC), std::end(MAGIC));
+    putU16(header, VERSION);
+    putU32(header, static_cast<uint32_t>(files.size()));
+
+    size_t indexBytes = 0;
+    for (const std::string& file : files) indexBytes += 2 + file.size() + 8 * 3;
+    size_t offset = alignUp(header.size() + indexBytes, DATA_ALIGNMENT);
+    for (size_t i = 0; i < files.size(); ++i) {
+        putString(header, files[i]);
+        putU64(header, offset);
+        putU64(header, contents[i].size());
+        putU64(header, hash(contents[i].data(), contents[i].size()));
+        offset = alignUp(offset + contents[i].size(), DATA_ALIGNMENT);
+    }
+
+    std::vector<Blob> blobs;
+    for (const std::vector<char>& data : contents) blobs.push_back({ data.data(), data.size() });
+    if (!writeFileAtomically(path, header, blobs, DATA_ALIGNMENT)) return false;
+    SDL_Log("AssetArchive: Wrote %zu files (%zu bytes) to '%s'.", files.size(), offset, path.c_str());
+    return true;
+}
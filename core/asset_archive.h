@@ -0,0 +1,56 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "mapped_file.h"
+
+// every asset the game loads packed into one file (by tools/asset_packer.cpp)
+// and mapped once at startup. the managers and AssetLoader read through
+// openFile(), which serves a file straight out of the mapping as an SDL memory
+// stream, or from disk when there is no archive or the file isn't in it. the
+// build repacks the archive after copying assets/ next to the game, so the two
+// never disagree there.
+// layout (little-endian): magic "SDAR", u16 version, u32 count, then per file
+// u16 path length, path, u64 offset, u64 bytes, u64 content hash (BinaryIO::hash);
+// file data starts on 16-byte boundaries
+class AssetArchive {
+public:
+    // delete copy constructor and assignment operator to enforce singleton
+    AssetArchive(const AssetArchive&) = delete;
+    AssetArchive& operator=(const AssetArchive&) = delete;
+
+    // get singleton instance
+    static AssetArchive& getInstance();
+
+    // false when the archive is missing or malformed; files then come from disk
+    bool open(const std::string& path);
+    // only once nothing loaded from the archive is alive (fonts keep reading from it)
+    void close();
+    bool isOpen() const { return m_file.isOpen(); }
+
+    // true if path (as spelled in Config) is served from the archive
+    bool contains(const std::string& path) const { return m_entries.count(path) != 0; }
+    // a read stream for path, or null if it can't be found anywhere. safe to
+    // call from several threads at once; the caller closes the stream
+    SDL_IOStream* openFile(const std::string& path) const;
+    // size and content hash of an archived file, as the packer recorded them
+    // (nothing is read); false if it isn't in the archive
+    bool getFileInfo(const std::string& path, uint64_t& bytes, uint64_t& hash) const;
+
+    // reads `files` from disk and writes (replaces) an archive of them at path
+    static bool write(const std::string& path, const std::vector<std::string>& files);
+
+private:
+    AssetArchive() = default;
+    ~AssetArchive() = default;
+
+    struct Entry {
+        const Uint8* data;
+        size_t bytes;
+        uint64_t hash;
+    };
+
+    MappedFile m_file;
+    std::unordered_map<std::string, Entry> m_entries;
+};
@@ -0,0 +1,141 @@
+#include "asset_loader.h"
+#include <SDL3_image/SDL_image.h>
+#include "asset_archive.h"
+#include "config.h"
+#include "font_manager.h"
+#include "sound_manager.h"
+#include "texture_manager.h"
+
+AssetLoader::~AssetLoader() {
+    wait();
+    release();
+}
+
+void AssetLoader::start(const AssetManifest& manifest, JobSystem* jobs, MIX_Mixer* mixer, const SDL_AudioSpec& audioSpec) {
+    wait();
+    release();
+    m_manifest = manifest;
+    m_jobs = jobs;
+    m_mixer = mixer;
+    m_audioSpec = audioSpec;
+    m_images.assign(m_manifest.images.size(), nullptr);
+    m_fonts.assign(m_manifest.fonts.size(), nullptr);
+    m_sounds.assign(m_manifest.sounds.size(), nullptr);
+    m_loaded = 0;
+    m_done = false;
+    m_startTimeNs = SDL_GetTicksNS();
+
+    m_thread = std::thread([this] {
+        // with an up-to-date pack, sounds are just pointers into it
+        m_soundPack = std::make_unique<SoundPack>();
+        bool packed = m_mixer && m_soundPack->open(Config::Sounds::DECODED_PACK, m_manifest.sounds, m_audioSpec);
+        if (m_mixer && !packed) {
+            m_pcm.assign(m_manifest.sounds.size(), {});
+            m_sources.assign(m_manifest.sounds.size(), {});
+        }
+
+        size_t count = m_manifest.size();
+        if (m_jobs) {
+            // one file per job: they differ too much in cost to group
+            m_jobs->parallelFor(count, 1, [this](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) decode(i);
+            });
+        } else {
+            for (size_t i = 0; i < count; ++i) decode(i);
+        }
+
+        // the next run maps what was just decoded
+        if (!m_pcm.empty()) {
+            bool complete = true;
+            for (const std::vector<Uint8>& pcm : m_pcm) complete = complete && !pcm.empty();
+            if (complete) SoundPack::write(Config::Sounds::DECODED_PACK, m_manifest.sounds, m_pcm, m_sources, m_audioSpec);
+            m_pcm.clear();
+            m_sources.clear();
+        }
+        m_done.store(true, std::memory_order_release);
+    });
+}
+
+void AssetLoader::decode(size_t index) {
+    if (index < m_images.size()) {
+        const std::string& file = m_manifest.images[index];
+        SDL_IOStream* io = AssetArchive::getInstance().openFile(file);
+        m_images[index] = io ? IMG_Load_IO(io, true) : nullptr;
+        if (!m_images[index]) SDL_Log("AssetLoader: Failed to load image '%s': %s", file.c_str(), SDL_GetError());
+    } else if ((index -= m_images.size()) < m_fonts.size()) {
+        const AssetManifest::Font& font = m_manifest.fonts[index];
+        SDL_IOStream* io = AssetArchive::getInstance().openFile(font.file);
+        m_fonts[index] = io ? TTF_OpenFontIO(io, true, font.size) : nullptr; // reads glyphs from io for as long as it lives
+        if (!m_fonts[index]) SDL_Log("AssetLoader: Failed to load font '%s' with size %d: %s", font.file.c_str(), font.size, SDL_GetError());
+    } else if ((index -= m_fonts.size()) < m_sounds.size() && m_mixer) {
+        if (!loadSound(index)) SDL_Log("AssetLoader: Failed to load sound '%s': %s", m_manifest.sounds[index].c_str(), SDL_GetError());
+    }
+    m_loaded.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool AssetLoader::loadSound(size_t index) {
+    const std::string& file = m_manifest.sounds[index];
+
+    // already in the device format: the mixer plays straight from the mapping
+    if (m_soundPack->isOpen()) {
+        size_t bytes = 0;
+        const void* samples = m_soundPack->find(file, bytes);
+        m_sounds[index] = samples ? MIX_LoadRawAudioNoCopy(m_mixer, samples, bytes, &m_audioSpec, false) : nullptr;
+        return m_sounds[index] != nullptr;
+    }
+
+    std::vector<Uint8>& pcm = m_pcm[index];
+    if (!SoundPack::decode(file, m_audioSpec, pcm, m_sources[index])) return false;
+    m_sounds[index] = MIX_LoadRawAudio(m_mixer, pcm.data(), pcm.size(), &m_audioSpec); // copies
+    return m_sounds[index] != nullptr;
+}
+
+int AssetLoader::install(SDL_Renderer* renderer) {
+    wait();
+    int failed = 0;
+
+    // the atlas packs whatever decoded; missing sprites fall back to plain rects
+    for (SDL_Surface* image : m_images) failed += image ? 0 : 1;
+    if (!TextureManager::getInstance().buildAtlas(renderer, m_images.data(), static_cast<int>(m_images.size()))) {
+        SDL_Log("AssetLoader: Failed to build the sprite atlas, sprites will be drawn as plain rects.");
+    }
+    m_images.clear(); // the atlas freed them
+
+    for (size_t i = 0; i < m_fonts.size(); ++i) {
+        if (!m_fonts[i]) { ++failed; continue; }
+        FontManager::getInstance().addFont(m_manifest.fonts[i].file, m_manifest.fonts[i].size, m_fonts[i]);
+        m_fonts[i] = nullptr;
+    }
+    // the mapping has to outlive every sound loaded from it
+    if (m_soundPack && m_soundPack->isOpen()) SoundManager::getInstance().setSoundPack(std::move(m_soundPack));
+    for (size_t i = 0; i < m_sounds.size(); ++i) {
+        if (!m_sounds[i]) { failed += m_mixer ? 1 : 0; continue; }
+        SoundManager::getInstance().addSound(m_manifest.sounds[i], m_sounds[i]);
+        m_sounds[i] = nullptr;
+    }
+    if (m_mixer) SoundManager::getInstance().bindEffects();
+
+    SDL_Log("AssetLoader: Loaded %d of %d assets in %.1f ms.", getTotalCount() - failed, getTotalCount(),
+            (SDL_GetTicksNS() - m_startTimeNs) / 1e6);
+    return failed;
+}
+
+void AssetLoader::wait() {
+    if (m_thread.joinable()) m_thread.join();
+}
+
+void AssetLoader::release() {
+    for (SDL_Surface* image : m_images) SDL_DestroySurface(image);
+    for (TTF_Font* font : m_fonts) {
+        if (font) TTF_CloseFont(font);
+    }
+    for (MIX_Audio* sound : m_sounds) {
+        if (sound) MIX_DestroyAudio(sound);
+    }
+    m_images.clear();
+    m_fonts.clear();
+    m_sounds.clear();
+    m_soundPack.reset(); // after the sounds that point into it
+    m_pcm.clear();
+    m_sources.clear();
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <SDL3_mixer/SDL_mixer.h>
+#include <SDL3_ttf/SDL_ttf.h>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "asset_manifest.h"
+#include "job_system.h"
+#include "sound_pack.h"
+
+// decodes everything in a manifest off the main thread: images to surfaces,
+// fonts opened, sounds taken from the decoded sound pack (or, when it's missing
+// or stale, decoded to the device format and the pack rewritten), one file per
+// job on the job system's workers. the main thread stays free to draw a loading
+// screen from getProgress(), then install()s the results into TextureManager,
+// FontManager and SoundManager, which is where the GPU upload happens. after
+// that nothing the game draws or plays is loaded on first use
+class AssetLoader {
+public:
+    AssetLoader() = default;
+    ~AssetLoader(); // waits for the decode to finish and frees anything not installed
+    AssetLoader(const AssetLoader&) = delete;
+    AssetLoader& operator=(const AssetLoader&) = delete;
+
+    // returns at once. jobs may be null (decode on one background thread);
+    // sounds are skipped without a mixer, and decoded to audioSpec
+    void start(const AssetManifest& manifest, JobSystem* jobs, MIX_Mixer* mixer, const SDL_AudioSpec& audioSpec);
+
+    int getLoadedCount() const { return m_loaded.load(std::memory_order_relaxed); }
+    int getTotalCount() const { return static_cast<int>(m_manifest.size()); }
+    float getProgress() const { return getTotalCount() > 0 ? static_cast<float>(getLoadedCount()) / getTotalCount() : 1.0f; }
+    bool isDone() const { return m_done.load(std::memory_order_acquire); }
+
+    // main thread, after isDone(): hands every decoded asset to its manager and
+    // builds the sprite atlas. returns the number of files that failed to load
+    int install(SDL_Renderer* renderer);
+
+private:
+    AssetManifest m_manifest;
+    MIX_Mixer* m_mixer = nullptr;
+    SDL_AudioSpec m_audioSpec = {};
+    JobSystem* m_jobs = nullptr;
+
+    // one slot per manifest entry, each written by exactly one job
+    std::vector<SDL_Surface*> m_images;
+    std::vector<TTF_Font*> m_fonts;
+    std::vector<MIX_Audio*> m_sounds;
+    std::unique_ptr<SoundPack> m_soundPack; // mapped, backs m_sounds; handed to SoundManager on install
+    std::vector<std::vector<Uint8>> m_pcm;  // freshly decoded sounds for a new pack
+    std::vector<SoundPack::Source> m_sources; // what each of m_pcm was decoded from
+
+    std::thread m_thread; // runs parallelFor so start() doesn't block
+    std::atomic<int> m_loaded{0};
+    std::atomic<bool> m_done{false};
+    Uint64 m_startTimeNs = 0;
+
+    void decode(size_t index);
+    bool loadSound(size_t index);
+    void wait();
+    void release(); // frees whatever is still held
+};
@@ -0,0 +1,17 @@
+#include "asset_manifest.h"
+#include "config.h"
+#include "text_renderer.h"
+
+AssetManifest AssetManifest::fromConfig() {
+    AssetManifest manifest;
+    for (const std::string& file : Config::Textures::SPRITE_FILES) {
+        manifest.images.push_back(file);
+    }
+    for (int i = 0; i <= static_cast<int>(FontSize::GRANDELOCO); ++i) {
+        manifest.fonts.push_back({ Config::Fonts::DEFAULT_FONT_FILE, TextRenderer::getPixelSize(static_cast<FontSize>(i)) });
+    }
+    for (const std::string& file : Config::Sounds::SOUND_FILES) {
+        manifest.sounds.push_back(file);
+    }
+    return manifest;
+}
@@ -0,0 +1,20 @@
+#pragma once
+#include <string>
+#include <vector>
+
+// every file the game loads, so they can all be decoded up front instead of on
+// first use. built from Config::Textures, Config::Fonts and Config::Sounds
+struct AssetManifest {
+    struct Font {
+        std::string file;
+        int size; // px; one entry per FontSize the text renderer builds
+    };
+
+    std::vector<std::string> images; // indexed by SpriteId
+    std::vector<Font> fonts;
+    std::vector<std::string> sounds;
+
+    static AssetManifest fromConfig();
+
+    size_t size() const { return images.size() + fonts.size() + sounds.size(); }
+};
@@ -0,0 +1,39 @@
+#include "binary_io.h"
+#include <SDL3/SDL.h>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+
+bool BinaryIO::writeFileAtomically(const std::string& path, const std::vector<uint8_t>& header, const std::vector<Blob>& blobs, size_t alignment) {
+    std::string temporary = path + ".tmp";
+    {
+        std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) {
+            SDL_Log("BinaryIO: Failed to open '%s' for writing", temporary.c_str());
+            return false;
+        }
+        const std::vector<char> zeros(alignment, 0);
+        out.write(reinterpret_cast<const char*>(header.data()), header.size());
+        size_t written = header.size();
+        for (const Blob& blob : blobs) {
+            out.write(zeros.data(), alignUp(written, alignment) - written);
+            written = alignUp(written, alignment);
+            out.write(static_cast<const char*>(blob.data), blob.size);
+            written += blob.size;
+        }
+        if (!out) {
+            SDL_Log("BinaryIO: Failed writing '%s'", temporary.c_str());
+            out.close();
+            std::remove(temporary.c_str());
+            return false;
+        }
+    }
+    std::error_code error;
+    std::filesystem::rename(temporary, path, error);
+    if (error) {
+        SDL_Log("BinaryIO: Failed to replace '%s': %s", path.c_str(), error.message().c_str());
+        std::remove(temporary.c_str());
+        return false;
+    }
+    return true;
+}
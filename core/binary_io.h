@@ -0,0 +1,92 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// the fixed little-endian layout shared by the game's binary files (input
+// recordings, the sound pack, the asset archive), so they move between machines
+namespace BinaryIO {
+    inline size_t alignUp(size_t value, size_t alignment) { return (value + alignment - 1) & ~(alignment - 1); }
+
+    // 64-bit FNV-1a; pass the previous result back in to hash data arriving in pieces
+    const uint64_t HASH_SEED = 14695981039346656037ull;
+    inline uint64_t hash(const void* data, size_t size, uint64_t h = HASH_SEED) {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        for (size_t i = 0; i < size; ++i) h = (h ^ bytes[i]) * 1099511628211ull;
+        return h;
+    }
+
+    inline void putU8(std::vector<uint8_t>& out, uint8_t v) { out.push_back(v); }
+    inline void putU16(std::vector<uint8_t>& out, uint16_t v) {
+        out.push_back(static_cast<uint8_t>(v));
+        out.push_back(static_cast<uint8_t>(v >> 8));
+    }
+    inline void putU32(std::vector<uint8_t>& out, uint32_t v) {
+        for (int i = 0; i < 4; ++i) out.push_back(static_cast<uint8_t>(v >> (8 * i)));
+    }
+    inline void putU64(std::vector<uint8_t>& out, uint64_t v) {
+        for (int i = 0; i < 8; ++i) out.push_back(static_cast<uint8_t>(v >> (8 * i)));
+    }
+    inline void putI32(std::vector<uint8_t>& out, int v) { putU32(out, static_cast<uint32_t>(v)); }
+    inline void putF32(std::vector<uint8_t>& out, float v) {
+        uint32_t bits;
+        std::memcpy(&bits, &v, sizeof(bits));
+        putU32(out, bits);
+    }
+    // u16 length, then the bytes
+    inline void putString(std::vector<uint8_t>& out, const std::string& s) {
+        putU16(out, static_cast<uint16_t>(s.size()));
+        out.insert(out.end(), s.begin(), s.end());
+    }
+
+    // bounds-checked reads; ok goes (and stays) false past the end
+    struct Reader {
+        const uint8_t* data;
+        size_t size;
+        size_t pos = 0;
+        bool ok = true;
+
+        uint64_t get(int bytes) {
+            if (!ok || pos + bytes > size) {
+                ok = false;
+                return 0;
+            }
+            uint64_t v = 0;
+            for (int i = 0; i < bytes; ++i) v |= static_cast<uint64_t>(data[pos++]) << (8 * i);
+            return v;
+        }
+        uint8_t u8() { return static_cast<uint8_t>(get(1)); }
+        uint16_t u16() { return static_cast<uint16_t>(get(2)); }
+        uint32_t u32() { return static_cast<uint32_t>(get(4)); }
+        uint64_t u64() { return get(8); }
+        int i32() { return static_cast<int>(u32()); }
+        float f32() {
+            uint32_t bits = u32();
+            float v;
+            std::memcpy(&v, &bits, sizeof(v));
+            return v;
+        }
+        std::string str(size_t length) {
+            if (!ok || pos + length > size) {
+                ok = false;
+                return {};
+            }
+            std::string s(reinterpret_cast<const char*>(data + pos), length);
+            pos += length;
+            return s;
+        }
+        std::string string() { return str(u16()); } // as written by putString
+    };
+
+    struct Blob {
+        const void* data;
+        size_t size;
+    };
+
+    // writes header, then each blob starting on an `alignment` boundary (zero
+    // padded), to path.tmp and renames it over path, so a crash never leaves a
+    // half-written file. logs and returns false on failure
+    bool writeFileAtomically(const std::string& path, const std::vector<uint8_t>& header, const std::vector<Blob>& blobs, size_t alignment);
+}
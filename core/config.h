@@ -1,4 +1,5 @@
 #pragma once
+#include <cstddef>
 #include <string>
 
 enum class FontSize {
@@ -8,6 +9,17 @@ enum class FontSize {
     GRANDELOCO
 };
 
+// stable index of every sprite image; the renderer looks sprites up by id, not by file name
+enum class SpriteId {
+    PLAYER,
+    BASIC_OPPONENT,
+    AGGRESSIVE_OPPONENT,
+    SNIPER_OPPONENT,
+    PLAYER_HEALTH_ITEM,
+    WORLD_HEALTH_ITEM,
+    COUNT
+};
+
 namespace Config {
     namespace Textures {
         const std::string PLAYER = "assets/defender.png";
@@ -16,6 +28,17 @@ namespace Config {
         const std::string SNIPER_OPPONENT = "assets/sniper_opponent.png";
         const std::string PLAYER_HEALTH_ITEM = "assets/health_player.png";
         const std::string WORLD_HEALTH_ITEM = "assets/health_world.png";
+
+        // indexed by SpriteId, all packed into one atlas at startup
+        const std::string SPRITE_FILES[] = {
+            PLAYER,
+            BASIC_OPPONENT,
+            AGGRESSIVE_OPPONENT,
+            SNIPER_OPPONENT,
+            PLAYER_HEALTH_ITEM,
+            WORLD_HEALTH_ITEM
+        };
+        static_assert(sizeof(SPRITE_FILES) / sizeof(SPRITE_FILES[0]) == static_cast<size_t>(SpriteId::COUNT), "one file per SpriteId");
     } 
 
     namespace Fonts {
@@ -29,10 +52,32 @@ namespace Config {
         const std::string HIGH_SCORES_PATH = "resources/highscores.txt";
     }
 
+    namespace Timing {
+        const int TICK_RATE = 60;          // simulation ticks per second
+        const int MAX_CATCH_UP_TICKS = 12; // back-to-back ticks after a stall before the rest is dropped (200 ms at 60 Hz)
+        const int FRAME_CAP = 0;           // frames per second; 0 = VSync (or, without it, the display rate)
+        const int MENU_FRAME_CAP = 30;     // menus and game over screens barely change
+        const int FALLBACK_FRAME_CAP = 60; // no VSync and the display rate is unknown
+    }
+
     namespace Sounds {
         const std::string GAME_START = "assets/audio/431243__audiopapkin__futuristic-organic-effect-39.wav";
         const std::string GAME_OVER = "assets/audio/159408__noirenex__life-lost-game-over.wav";
         const std::string PLAYER_SHOOT = "assets/audio/95933__robinhood76__01665-thin-laser-blast.wav";
         const std::string OPPONENT_EXPLODE = "assets/audio/372182__supersound23__pop.mp3";
+        const std::string SOUND_FILES[] = {
+            GAME_START,
+            GAME_OVER,
+            PLAYER_SHOOT,
+            OPPONENT_EXPLODE
+        };
+
+        // all of the above decoded to the device format on first run (see SoundPack)
+        const std::string DECODED_PACK = "resources/sounds.pack";
+    }
+
+    namespace Assets {
+        // everything above in one file (tools/asset_packer.cpp); loose files are used when it's missing
+        const std::string ARCHIVE = "assets.pak";
     }
 }
\ No newline at end of file
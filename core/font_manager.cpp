@@ -2,6 +2,7 @@
 #include <SDL3_ttf/SDL_ttf.h>
 #include <iostream>
 #include <sstream>
+#include "asset_archive.h"
 
 FontManager& FontManager::getInstance() {
     static FontManager instance;
@@ -9,11 +10,7 @@ FontManager& FontManager::getInstance() {
 }
 
 std::shared_ptr<TTF_Font> FontManager::getFont(const std::string& filepath, int size) {
-
-    //a unique key for filepath and size combination
-    std::ostringstream keyStream;
-    keyStream << filepath << "_" << size;
-    std::string key = keyStream.str();
+    std::string key = makeKey(filepath, size);
 
     auto it = m_fontCache.find(key);
     if (it != m_fontCache.end()) {
@@ -21,7 +18,8 @@ std::shared_ptr<TTF_Font> FontManager::getFont(const std::string& filepath, int
         return it->second;
     }
 
-    TTF_Font* font = TTF_OpenFont(filepath.c_str(), size);
+    SDL_IOStream* io = AssetArchive::getInstance().openFile(filepath);
+    TTF_Font* font = io ? TTF_OpenFontIO(io, true, size) : nullptr;
     if (!font) {
         SDL_Log("FontManager: Failed to load font '%s' with size %d: %s", filepath.c_str(), size, SDL_GetError());
         return nullptr; 
@@ -38,6 +36,17 @@ std::shared_ptr<TTF_Font> FontManager::getFont(const std::string& filepath, int
     return sharedFont;
 }
 
+void FontManager::addFont(const std::string& filepath, int size, TTF_Font* font) {
+    m_fontCache[makeKey(filepath, size)] = std::shared_ptr<TTF_Font>(font, TTF_Font_Deleter{});
+}
+
+std::string FontManager::makeKey(const std::string& filepath, int size) {
+    //a unique key for filepath and size combination
+    std::ostringstream keyStream;
+    keyStream << filepath << "_" << size;
+    return keyStream.str();
+}
+
 void FontManager::clearCache() {
     SDL_Log("FontManager: Clearing cache and closing %zu fonts.", m_fontCache.size());
     m_fontCache.clear(); // will automatically call the deleter for each font
@@ -17,6 +17,8 @@ public:
     static FontManager& getInstance();
 
     std::shared_ptr<TTF_Font> getFont(const std::string& filepath, int size);
+    // caches a font opened elsewhere (AssetLoader); the manager closes it
+    void addFont(const std::string& filepath, int size, TTF_Font* font);
 
     void clearCache();
 
@@ -25,6 +27,8 @@ private:
     ~FontManager();
 
     std::unordered_map<std::string, std::shared_ptr<TTF_Font>> m_fontCache;
+
+    static std::string makeKey(const std::string& filepath, int size);
 };
 
 struct TTF_Font_Deleter {
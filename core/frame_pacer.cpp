@@ -0,0 +1,21 @@
+#include "frame_pacer.h"
+
+void FramePacer::setPeriod(Uint64 periodNs) {
+    if (periodNs != m_periodNs) m_deadlineNs = 0;
+    m_periodNs = periodNs;
+}
+
+void FramePacer::wait() {
+    if (m_periodNs == 0) return;
+
+    Uint64 now = SDL_GetTicksNS();
+    if (m_deadlineNs == 0 || now > m_deadlineNs + m_periodNs) {
+        m_deadlineNs = now + m_periodNs;
+    } else {
+        m_deadlineNs += m_periodNs;
+    }
+
+    // sleeps most of the way and only spins the last stretch, so the CPU idles
+    // but the wake-up still lands on the deadline
+    if (m_deadlineNs > now) SDL_DelayPrecise(m_deadlineNs - now);
+}
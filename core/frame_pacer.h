@@ -0,0 +1,20 @@
+#pragma once
+#include <SDL3/SDL.h>
+
+// holds a loop to a fixed period by sleeping instead of spinning. deadlines are
+// kept on a fixed grid (one period apart), so short sleeps and long frames even
+// out instead of drifting; a loop that falls more than a period behind starts a
+// new grid rather than racing to catch up
+class FramePacer {
+public:
+    void setPeriod(Uint64 periodNs); // 0 never waits
+    void setRate(int perSecond) { setPeriod(perSecond > 0 ? SDL_NS_PER_SECOND / perSecond : 0); }
+    Uint64 getPeriod() const { return m_periodNs; }
+
+    // call once per iteration, after the work; returns once the next deadline is reached
+    void wait();
+
+private:
+    Uint64 m_periodNs = 0;
+    Uint64 m_deadlineNs = 0; // 0 = start a new grid on the next wait()
+};
@@ -1,27 +1,36 @@
 #include "game.h"
-#include <cstdlib>
-#include <ctime>
 #include <algorithm>
 #include <fstream>
 #include <sstream>
 #include <cctype>
 #include "../core/config.h"
+#include "../core/profiler.h"
 #include "../entities/health_item.h"
 
-Game::Game()
+namespace {
+    const uint64_t GAMEPLAY_STREAM = 1;
+    const uint64_t EFFECTS_STREAM = 2;
+}
+
+Game::Game(uint64_t seed)
     : m_state{} {
-    srand((unsigned int)time(nullptr));
+    setSeed(seed);
     m_state.worldWidth = Config::Game::WORLD_WIDTH;
     m_state.worldHeight = Config::Game::WORLD_HEIGHT; // TODO
     loadHighScores();
 }
 
+void Game::setSeed(uint64_t seed) {
+    m_seed = seed;
+    m_rng.reseed(seed, GAMEPLAY_STREAM);
+    m_fxRng.reseed(seed, EFFECTS_STREAM);
+}
+
 void Game::startNewGame() {
-    m_mixer = SoundManager::getInstance().getMixerInstance();
-    if (m_mixer) 
-        SoundManager::getInstance().playSound(Config::Sounds::GAME_START, m_mixer);
+    playSound(SoundEffect::GAME_START);
 
     m_state.opponents.clear();
+    m_state.projectiles.clear();
     m_state.particles.clear();
     m_state.healthItems.clear();
     m_state.cameraX = 0.0f;
@@ -40,41 +49,21 @@ void Game::startNewGame() {
     m_playerHealthItemSpawnTimer = 0.0f;
     m_worldHealthItemSpawnTimer = 0.0f;
 
-    setLandscape();
-}
-
-void Game::setLandscape() {
-    m_state.landscape = {
-        {0, m_state.worldHeight - 20},
-        {m_state.worldWidth * 0.1f, m_state.worldHeight - 28},
-        {m_state.worldWidth * 0.18f, m_state.worldHeight - 38},
-        {m_state.worldWidth * 0.225f, m_state.worldHeight - 50},
-        {m_state.worldWidth * 0.25f, m_state.worldHeight - 40},
-        {m_state.worldWidth * 0.32f, m_state.worldHeight - 120},
-        {m_state.worldWidth * 0.41f, m_state.worldHeight - 100},
-        {m_state.worldWidth * 0.48f, m_state.worldHeight - 140},
-        {m_state.worldWidth * 0.52f, m_state.worldHeight - 95},
-        {m_state.worldWidth * 0.61f, m_state.worldHeight - 120},
-        {m_state.worldWidth * 0.68f, m_state.worldHeight - 80},
-        {m_state.worldWidth * 0.71f, m_state.worldHeight - 110},
-        {m_state.worldWidth * 0.75f, m_state.worldHeight - 90},
-        {m_state.worldWidth * 0.81f, m_state.worldHeight - 70},
-        {m_state.worldWidth * 0.86f, m_state.worldHeight - 110},
-        {m_state.worldWidth * 0.90f, m_state.worldHeight - 75},
-        {m_state.worldWidth * 0.93f, m_state.worldHeight - 90},
-        {m_state.worldWidth * 0.98f, m_state.worldHeight - 60},
-        {m_state.worldWidth, m_state.worldHeight - 40}
-    };
+    // a fresh landscape every game, drawn from the gameplay stream
+    m_state.terrain.generate(nextSeed(), m_state.worldWidth, m_state.worldHeight);
+    updateCamera();
+    m_state.previousCameraX = m_state.cameraX; // no sweep in from the last game's camera
 }
 
 void Game::update(float deltaTime) {
     if (m_state.state != GameStateData::State::PLAYING) return;
+    PROFILE_SCOPE(ProfileSection::GAME_UPDATE);
 
     // detect window resize for landscape
     if (m_state.screenHeight != m_lastWindowHeight) {
         m_lastWindowHeight = m_state.screenHeight;
         m_state.worldHeight = m_state.screenHeight; // for consistency, but not necessary
-        setLandscape();
+        m_state.terrain.setWorldHeight(m_state.worldHeight);
     }
 
     SDL_FRect pb;
@@ -82,89 +71,66 @@ void Game::update(float deltaTime) {
         pb = m_state.player->getBounds();
     }
 
-    m_state.player->update(deltaTime, m_state.particles);
+    {
+        PROFILE_SCOPE(ProfileSection::GAME_PLAYER);
+        m_state.player->update(deltaTime, m_state.particles, m_fxRng);
+    }
 
-    // player projectiles
-    auto& playerProjectiles = m_state.player->getProjectiles();        
-    updateAndPruneProjectiles(playerProjectiles, deltaTime);   
+    {
+        PROFILE_SCOPE(ProfileSection::GAME_PLAYER);
+        keepPlayerInBounds(pb);
+    }
 
-    keepPlayerInBounds(pb);
+    {
+        PROFILE_SCOPE(ProfileSection::GAME_OPPONENTS);
+        if (!updateAndPruneOpponents(pb, deltaTime)) return; // world destroyed, game over
+    }
 
-    // opponents / projectiles
-    for (auto opp_iter = m_state.opponents.begin(); opp_iter != m_state.opponents.end(); ) {
-        auto& oppPtr = *opp_iter;
-        if(!oppPtr) {
-            opp_iter = m_state.opponents.erase(opp_iter);
-            continue;
-        }
+    {
+        // after the opponents, so shots fired this tick move this tick
+        PROFILE_SCOPE(ProfileSection::GAME_PROJECTILES);
+        updateAndPruneProjectiles(deltaTime);
+    }
 
-        if(oppPtr->isAlive()) {
-            SDL_FPoint playerPos = { pb.x, pb.y };
-            oppPtr->update(deltaTime, playerPos, m_state.cameraX, m_state); // remember: world width is bigger than screen - height is same 
-            updateAndPruneProjectiles(oppPtr->getProjectiles(), deltaTime);
-        }
+    {
+        PROFILE_SCOPE(ProfileSection::GAME_PARTICLES);
+        updateAndPruneParticles(deltaTime);
+    }
 
-        // new: check if opponent hit landscape
-        SDL_FRect oppBounds = oppPtr->getBounds();
-        float oppCenterX = oppBounds.x + oppBounds.w / 2.0f;
-        float groundY = getGroundYAt(oppCenterX);
-        if (oppBounds.y + oppBounds.h >= groundY) {
-            BasicOpponent* b = dynamic_cast<BasicOpponent*>(oppPtr.get());
-            if (b) { // only basic opponents damage world
-                m_state.worldHealth--;
-                if (m_state.worldHealth <= 0) {
-                    // world health too low; game over
-                    if (m_mixer) 
-                        SoundManager::getInstance().playSound(Config::Sounds::GAME_OVER, m_mixer);
-
-                    m_state.state = GameStateData::State::GAME_OVER;
-                    if (isHighScore(m_state.playerScore)) {
-                        m_state.highScoreIndex = getHighScoreIndex(m_state.playerScore);
-                        m_state.waitingForHighScore = true;
-                        m_state.highScoreNameInput.clear();
-                    }
-                    return; // exit early if world health too low
-                }
-            }
-            // opponent touched ground - explode
-            oppPtr->explode(m_state.particles);
-            opp_iter = m_state.opponents.erase(opp_iter);
+    {
+        PROFILE_SCOPE(ProfileSection::GAME_HEALTH_ITEMS);
+        updateAndPruneHealthItems(deltaTime);
+    }
 
-            continue;
+    {
+        // spawn health items
+        PROFILE_SCOPE(ProfileSection::GAME_SPAWNING);
+        m_playerHealthItemSpawnTimer += deltaTime;
+        if (m_playerHealthItemSpawnTimer >= PLAYER_HEALTH_ITEM_SPAWN_INTERVAL) {
+            spawnHealthItem(HealthItemType::PLAYER);
+            m_playerHealthItemSpawnTimer = 0.0f;
         }
 
-        if (!oppPtr->isAlive()) {
-            opp_iter = m_state.opponents.erase(opp_iter);
-            continue;
+        m_worldHealthItemSpawnTimer += deltaTime;
+        if (m_worldHealthItemSpawnTimer >= WORLD_HEALTH_ITEM_SPAWN_INTERVAL) {
+            spawnHealthItem(HealthItemType::WORLD);
+            m_worldHealthItemSpawnTimer = 0.0f;
         }
-
-        ++opp_iter;
-    }
-
-    updateAndPruneParticles(deltaTime);
-
-    updateAndPruneHealthItems(deltaTime);
-
-    // spawn health items
-    m_playerHealthItemSpawnTimer += deltaTime;
-    if (m_playerHealthItemSpawnTimer >= PLAYER_HEALTH_ITEM_SPAWN_INTERVAL) {
-        spawnHealthItem(HealthItemType::PLAYER);
-        m_playerHealthItemSpawnTimer = 0.0f;
     }
 
-    m_worldHealthItemSpawnTimer += deltaTime;
-    if (m_worldHealthItemSpawnTimer >= WORLD_HEALTH_ITEM_SPAWN_INTERVAL) {
-        spawnHealthItem(HealthItemType::WORLD);
-        m_worldHealthItemSpawnTimer = 0.0f;
+    {
+        PROFILE_SCOPE(ProfileSection::GAME_COLLISIONS);
+        checkCollisions();
     }
-
-    checkCollisions();
     updateCamera();
 
-    m_opponentSpawnTimer += deltaTime;
-    if (m_opponentSpawnTimer >= OPPONENT_SPAWN_INTERVAL) {
-        spawnOpponent();
-        m_opponentSpawnTimer = 0.0f;
+    {
+        PROFILE_SCOPE(ProfileSection::GAME_SPAWNING);
+        m_opponentSpawnTimer += deltaTime;
+        if (m_opponentSpawnTimer >= OPPONENT_SPAWN_INTERVAL) {
+            spawnOpponent();
+            m_opponentSpawnTimer = 0.0f;
+        }
     }
 }
 
@@ -175,9 +141,14 @@ void Game::updateCamera() {
     if (target < 0) target = 0;
     if (target > m_state.worldWidth - m_state.screenWidth) target = m_state.worldWidth - m_state.screenWidth;
     m_state.cameraX = target;
+    m_state.terrain.update(m_state.cameraX, m_state.screenWidth);
 }
 
 void Game::handleInput(const GameInput& input, float deltaTime) {
+    // start of the tick: everything about to move remembers where it was
+    m_state.previousCameraX = m_state.cameraX;
+    if (m_state.player) m_state.player->storePreviousPosition();
+
     if (input.quit) {
         m_state.running = false;
         return;
@@ -233,7 +204,8 @@ void Game::handleInput(const GameInput& input, float deltaTime) {
             m_state.player->setSpeedBoost(input.boost);
 
             if (input.shoot && !m_prevShootState) { // current frame: pressed, previous frame: not pressed
-                m_state.player->shoot();
+                m_state.player->shoot(m_state.projectiles);
+                playSound(SoundEffect::PLAYER_SHOOT);
             }
             // update the previous state for the next frame
             m_prevShootState = input.shoot;
@@ -255,17 +227,16 @@ void Game::handleInput(const GameInput& input, float deltaTime) {
                 }
             }           
             
-            static float backspaceCooldown = 0.0f;
             const float BACKSPACE_DELAY = 0.1f; 
             if (input.backspacePressed) { 
-                if (backspaceCooldown <= 0.0f && !m_state.highScoreNameInput.empty()) {
+                if (m_backspaceCooldown <= 0.0f && !m_state.highScoreNameInput.empty()) {
                     m_state.highScoreNameInput.pop_back();
-                    backspaceCooldown = BACKSPACE_DELAY;
+                    m_backspaceCooldown = BACKSPACE_DELAY;
                 } else {
-                    backspaceCooldown = std::max(0.0f, backspaceCooldown - 1.0f/60.0f);
+                    m_backspaceCooldown = std::max(0.0f, m_backspaceCooldown - deltaTime);
                 }
             } else {
-                backspaceCooldown = 0.0f;
+                m_backspaceCooldown = 0.0f;
             }
 
             // process enter/click for submission/cancellation
@@ -308,148 +279,184 @@ void Game::handleInput(const GameInput& input, float deltaTime) {
 void Game::checkCollisions() {
     if (!m_state.player) return;
 
+    buildCollisionGrids();
+
     // collisions between player projectile and opponent
-    auto& pp = m_state.player->getProjectiles();
-    for (auto p_it = pp.begin(); p_it != pp.end(); ) {
+    auto& projectiles = m_state.projectiles;
+    for (auto p_it = projectiles.begin(); p_it != projectiles.end(); ) {
+        if (p_it->getFaction() != Faction::PLAYER) {
+            ++p_it;
+            continue;
+        }
         SDL_FRect pb = p_it->getBounds();
         bool projectileHit = false;
 
+        // candidates come back in colony order, so the first hit is the same opponent a full scan would find
+        m_opponentGrid.query(pb, m_gridHits);
+        if (m_gridHits.empty()) {
+            ++p_it;
+            continue;
+        }
+
         // for horizontal beams, find visual end X
         float beamY = p_it->getSpawnY();
         float startX = p_it->getSpawnX();
         bool goingRight = (p_it->getVelocity().x > 0);
-        // new: landscape stops beam
-        float visualEndX = getBeamVisualEndX(startX, beamY, goingRight);
+        // new: landscape stops beam. nothing past the farthest candidate matters
+        float limitX = startX;
+        for (uint32_t id : m_gridHits) {
+            const SDL_FRect& b = m_opponentRefs[id].bounds;
+            float cx = b.x + b.w / 2.0f;
+            limitX = goingRight ? std::max(limitX, cx) : std::min(limitX, cx);
+        }
+        float visualEndX = m_state.terrain.getBeamEndX(startX, beamY, goingRight, limitX);
 
-        for (auto& o : m_state.opponents) { // o is std::unique_ptr<BaseOpponent>&
-            if (!o || !o->isAlive()) continue;
+        for (uint32_t id : m_gridHits) {
+            OpponentRef& ref = m_opponentRefs[id];
+            BaseOpponent& o = *ref.opponent;
+            if (!o.isAlive()) continue;
 
             // new: skip if opponent is beyond the beam's visual range (landscape stopped it)
-            float oppCenterX = o->getBounds().x + o->getBounds().w / 2.0f;
+            float oppCenterX = ref.bounds.x + ref.bounds.w / 2.0f;
             if (goingRight && oppCenterX > visualEndX) continue;
             if (!goingRight && oppCenterX < visualEndX) continue;
 
-            if (rectsIntersect(o->getBounds(), pb)) {
-                o->takeDamage(1);
-                if (!o->isAlive()) {
-                    m_state.playerScore += o->getScoreVal();
-                    o->explode(m_state.particles);
+            if (rectsIntersect(ref.bounds, pb)) {
+                o.takeDamage(1);
+                if (!o.isAlive()) {
+                    m_state.playerScore += o.getScoreVal();
+                    explodeOpponent(o);
                 }
                 projectileHit = true;
                 break; // break inner loop
             }
         }
         if (projectileHit) {
-            p_it = pp.erase(p_it); // erase using projectile iterator, assign returned iterator
+            p_it = projectiles.erase(p_it); // erase using projectile iterator, assign returned iterator
         } else {
             ++p_it;
         }
     } 
 
-    // player collisions with opponents and opponent projectiles
-    if (m_state.player->isAlive()) {
-        for (auto o_it = m_state.opponents.begin(); o_it != m_state.opponents.end(); ) {
-            auto& o = *o_it;
-            if (!o || !o->isAlive()) {
-                 ++o_it; // skip dead opponents
-                 continue;
-            }
-
-            // check player/opponent collision
-            if (rectsIntersect(m_state.player->getBounds(), o->getBounds())) { 
-                m_state.player->takeDamage(1);
-                o->explode(m_state.particles); 
-                m_state.playerScore += o->getScoreVal();
-                o_it = m_state.opponents.erase(o_it);
-                if (!m_state.player->isAlive()) {
-                    if (m_mixer) 
-                            SoundManager::getInstance().playSound(Config::Sounds::GAME_OVER, m_mixer);
-                            
-                    m_state.state = GameStateData::State::GAME_OVER;
-                    if (isHighScore(m_state.playerScore)) {
-                        m_state.highScoreIndex = getHighScoreIndex(m_state.playerScore);
-                        m_state.waitingForHighScore = true;
-                        m_state.highScoreNameInput = ""; // initialize empty input
-                    }
-                    return; // exit early if player dies
-                }
-                continue; // skip projectile check if opponent was destroyed by collision
-            }
+    // player collisions with opponents, opponent projectiles and health items
+    if (!m_state.player->isAlive()) return;
+    SDL_FRect playerBounds = m_state.player->getBounds();
+
+    m_opponentGrid.query(playerBounds, m_gridHits);
+    for (uint32_t id : m_gridHits) {
+        OpponentRef& ref = m_opponentRefs[id];
+        if (!ref.opponent->isAlive() || !rectsIntersect(playerBounds, ref.bounds)) continue;
+        BaseOpponent& o = *ref.opponent;
+
+        m_state.player->takeDamage(1);
+        explodeOpponent(o);
+        m_state.playerScore += o.getScoreVal();
+        m_state.opponents.erase(ref.type, ref.opponent); // shots it already fired stay in flight
+        if (!m_state.player->isAlive()) {
+            endGame();
+            return; // exit early if player dies
+        }
+    }
 
-            // check if opponent's projectiles hit player
-            auto& op = o->getProjectiles(); 
-            for (auto op_it = op.begin(); op_it != op.end(); ) {
-                SDL_FRect projBounds = op_it->getBounds();
-                SDL_FRect playerBounds = m_state.player->getBounds();
-
-                // collision check ... projectile and player
-                if (rectsIntersect(projBounds, playerBounds)) {
-                    m_state.player->takeDamage(1);
-                    // erase the projectile that hit the player using the iterator
-                    op_it = op.erase(op_it);
-                    if (!m_state.player->isAlive()) {
-                        if (m_mixer) 
-                            SoundManager::getInstance().playSound(Config::Sounds::GAME_OVER, m_mixer);
-
-                        m_state.state = GameStateData::State::GAME_OVER;
-                        if (isHighScore(m_state.playerScore)) {
-                            m_state.highScoreIndex = getHighScoreIndex(m_state.playerScore);
-                            m_state.waitingForHighScore = true;
-                            m_state.highScoreNameInput = ""; // initialize empty input
-                        }
-                        return; // exit early if player dies
-                    }
-                } else {
-                    ++op_it;
-                }
-            }
+    // check if opponents' projectiles hit player (there is one target, so no grid needed)
+    for (auto p_it = projectiles.begin(); p_it != projectiles.end(); ) {
+        if (p_it->getFaction() != Faction::OPPONENT || !rectsIntersect(p_it->getBounds(), playerBounds)) {
+            ++p_it;
+            continue;
+        }
 
-            // increment opponent iterator only if the opponent itself wasn't erased in the player collision check
-            if (m_state.state != GameStateData::State::GAME_OVER && o_it != m_state.opponents.end()) { // check if state changed or iterator became invalid due to erase
-                ++o_it;
-            }
-            // ... if state is GAME_OVER or o_it was invalidated by erase in the inner loop, the outer loop will terminate
+        m_state.player->takeDamage(1);
+        // erase the projectile that hit the player
+        p_it = projectiles.erase(p_it);
+        if (!m_state.player->isAlive()) {
+            endGame();
+            return; // exit early if player dies
         }
+    }
 
-        // player / health collisions (restores player or world health)
-        for (auto it = m_state.healthItems.begin(); it != m_state.healthItems.end(); ) {
-            auto& item = *it;
-            if (!item || !item->isAlive() || item->isBlinking()) { // don't collide if blinking or dead
-                ++it;
-                continue;
-            }
-            if (rectsIntersect(m_state.player->getBounds(), item->getBounds())) {
-                if (item->getType() == HealthItemType::PLAYER) {
-                    m_state.player->restoreHealth();
-                } else if (item->getType() == HealthItemType::WORLD) {
-                    m_state.worldHealth = m_state.maxWorldHealth;
-                }
-                it = m_state.healthItems.erase(it);
-                continue;
-            }
-            ++it;
+    // player / health collisions (restores player or world health)
+    m_healthItemGrid.query(playerBounds, m_gridHits);
+    for (uint32_t id : m_gridHits) {
+        HealthItemRef& ref = m_healthItemRefs[id];
+        if (!rectsIntersect(playerBounds, ref.bounds)) continue;
+
+        if ((*ref.it)->getType() == HealthItemType::PLAYER) {
+            m_state.player->restoreHealth();
+        } else if ((*ref.it)->getType() == HealthItemType::WORLD) {
+            m_state.worldHealth = m_state.maxWorldHealth;
         }
+        m_state.healthItems.erase(ref.it);
+    }
+}
+
+void Game::buildCollisionGrids() {
+    m_opponentGrid.reset(COLLISION_CELL_SIZE);
+    m_healthItemGrid.reset(COLLISION_CELL_SIZE);
+    m_opponentRefs.clear();
+    m_healthItemRefs.clear();
+
+    addOpponentsToGrid(m_state.opponents.basic);
+    addOpponentsToGrid(m_state.opponents.aggressive);
+    addOpponentsToGrid(m_state.opponents.sniper);
+
+    for (auto it = m_state.healthItems.begin(); it != m_state.healthItems.end(); ++it) {
+        auto& item = *it;
+        if (!item || !item->isAlive() || item->isBlinking()) continue; // don't collide if blinking or dead
+        SDL_FRect bounds = item->getBounds();
+        m_healthItemGrid.insert(static_cast<uint32_t>(m_healthItemRefs.size()), bounds);
+        m_healthItemRefs.push_back({ it, bounds });
+    }
+
+    m_opponentGrid.build();
+    m_healthItemGrid.build();
+}
+
+template <typename Opponent>
+void Game::addOpponentsToGrid(plf::colony<Opponent>& pool) {
+    for (Opponent& o : pool) {
+        uint32_t id = static_cast<uint32_t>(m_opponentRefs.size());
+        SDL_FRect bounds = o.getBounds();
+        m_opponentRefs.push_back({ &o, Opponent::TYPE, bounds });
+        if (o.isAlive())
+            m_opponentGrid.insert(id, bounds);
+    }
+}
+
+void Game::endGame() {
+    playSound(SoundEffect::GAME_OVER);
+
+    m_state.state = GameStateData::State::GAME_OVER;
+    if (isHighScore(m_state.playerScore)) {
+        m_state.highScoreIndex = getHighScoreIndex(m_state.playerScore);
+        m_state.waitingForHighScore = true;
+        m_state.highScoreNameInput.clear(); // initialize empty input
+        m_backspaceCooldown = 0.0f;
     }
 }
 
 void Game::spawnOpponent() {
-    int type = rand() % 3;
-    float x = (float)(rand() % (int)(m_state.worldWidth - 50));
+    int type = m_rng.nextInt(3);
+    float x = (float)m_rng.nextInt((int)(m_state.worldWidth - 50));
     float y = -50.0f;
     switch (type) {
-        case 0: m_state.opponents.emplace(std::make_unique<BasicOpponent>(x, y, 40, 40)); break;
-        case 1: m_state.opponents.emplace(std::make_unique<AggressiveOpponent>(x, y, 45, 45)); break;
-        case 2: m_state.opponents.emplace(std::make_unique<SniperOpponent>(x, y, 35, 35)); break;
+        case 0: m_state.opponents.basic.emplace(x, y, 40, 40, nextSeed()); break;
+        case 1: m_state.opponents.aggressive.emplace(x, y, 45, 45, nextSeed()); break;
+        case 2: m_state.opponents.sniper.emplace(x, y, 35, 35, nextSeed()); break;
     }
 }
 
+void Game::explodeOpponent(const BaseOpponent& opponent) {
+    opponent.explode(m_state.particles, m_fxRng);
+    playSound(SoundEffect::OPPONENT_EXPLODE);
+}
+
 void Game::spawnHealthItem(HealthItemType type) {
-    float x = static_cast<float>(rand() % static_cast<int>(m_state.worldWidth - 50)); // random X within world
+    float x = static_cast<float>(m_rng.nextInt(static_cast<int>(m_state.worldWidth - 50))); // random X within world
     float y = -50.0f; // start from top
     float w = 30.0f;
     float h = 30.0f;
-    const std::string& textureKey = (type == HealthItemType::PLAYER) ? Config::Textures::PLAYER_HEALTH_ITEM : Config::Textures::WORLD_HEALTH_ITEM;
-    m_state.healthItems.emplace(std::make_unique<HealthItem>(x, y, w, h, type, textureKey));
+    SpriteId spriteId = (type == HealthItemType::PLAYER) ? SpriteId::PLAYER_HEALTH_ITEM : SpriteId::WORLD_HEALTH_ITEM;
+    m_state.healthItems.emplace(std::make_unique<HealthItem>(x, y, w, h, type, spriteId, m_rng));
 }
 
 // handle high scores
@@ -522,12 +529,33 @@ void Game::submitHighScore(const std::string& name) {
         if (m_state.highScores.size() > m_state.MAX_HIGH_SCORES) {
             m_state.highScores.pop_back();
         }
-        saveHighScores();
+        if (m_saveHighScores) saveHighScores();
     }
 }
 // END: handle high scores
 
 // helpers
+void Game::playSound(SoundEffect effect) {
+    if (m_soundSink)
+        m_soundSink->play(effect);
+}
+
+void Game::parallelFor(size_t count, size_t grain, const JobSystem::RangeFn& fn) {
+    if (m_jobs) {
+        m_jobs->parallelFor(count, grain, fn);
+        return;
+    }
+    // same chunks, in order, on this thread
+    for (size_t begin = 0; begin < count; begin += grain) {
+        fn(begin, std::min(begin + grain, count));
+    }
+}
+
+uint64_t Game::nextSeed() {
+    uint64_t seed = m_rng.next();
+    return (seed << 32) | m_rng.next();
+}
+
 bool Game::rectsIntersect(const SDL_FRect& a, const SDL_FRect& b) const {
     return (a.x < b.x + b.w &&
             a.x + a.w > b.x &&
@@ -540,9 +568,29 @@ bool Game::isOutOfWorld(const SDL_FRect& r, float mx, float my) const {
             r.y + r.h < -my || r.y > m_state.worldHeight + my);
 }
 
-void Game::updateAndPruneProjectiles(plf::colony<Projectile>& projectiles, float deltaTime) {
-    for (auto it = projectiles.begin(); it != projectiles.end(); ) {
-        it->update(deltaTime);
+void Game::updateAndPruneProjectiles(float deltaTime) {
+    auto& projectiles = m_state.projectiles;
+    if (projectiles.empty()) return;
+
+    // move everything first (in parallel), then look up the ground under each chunk in one batch
+    m_projectileScratch.clear();
+    for (auto& p : projectiles) m_projectileScratch.push_back(&p);
+    size_t count = m_projectileScratch.size();
+    m_groundQueryX.resize(count);
+    m_groundQueryY.resize(count);
+    parallelFor(count, PROJECTILE_GRAIN, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            Projectile& p = *m_projectileScratch[i];
+            p.update(deltaTime);
+            SDL_FRect b = p.getBounds();
+            m_groundQueryX[i] = b.x + b.w / 2.0f;
+        }
+        m_state.terrain.getGroundYAt(m_groundQueryX.data() + begin, m_groundQueryY.data() + begin, end - begin);
+    });
+
+    // pruning erases, so it stays on this thread
+    size_t i = 0;
+    for (auto it = projectiles.begin(); it != projectiles.end(); ++i) {
         SDL_FRect b = it->getBounds();
         
         if (isOutOfWorld(b, 0.0f, 0.0f)) {
@@ -551,8 +599,7 @@ void Game::updateAndPruneProjectiles(plf::colony<Projectile>& projectiles, float
         }
 
         // TODO: this part could be restricted to !it->isHorizontal because this is just for opponent projectiles
-        float projCenterX = b.x + b.w / 2.0f;
-        float groundY = getGroundYAt(projCenterX);
+        float groundY = m_groundQueryY[i];
         float projBottom = b.y + b.h;
 
         // if projectile is at or below ground - remove it
@@ -565,103 +612,83 @@ void Game::updateAndPruneProjectiles(plf::colony<Projectile>& projectiles, float
     }
 }
 
-void Game::updateAndPruneParticles(float deltaTime) {
-    for (auto it = m_state.particles.begin(); it != m_state.particles.end(); ) {
-        it->update(deltaTime);
-        if (!it->isAlive()) 
-            it = m_state.particles.erase(it);
-        else 
-            ++it;
-    }
+bool Game::updateAndPruneOpponents(const SDL_FRect& pb, float deltaTime) {
+    SDL_FPoint playerPos = { pb.x, pb.y };
+    return updateAndPruneOpponentPool(m_state.opponents.basic, playerPos, deltaTime)
+        && updateAndPruneOpponentPool(m_state.opponents.aggressive, playerPos, deltaTime)
+        && updateAndPruneOpponentPool(m_state.opponents.sniper, playerPos, deltaTime);
 }
 
-float Game::getGroundYAt(float x) const {
-    const auto& land = m_state.landscape;
-    if (land.empty()) return m_state.worldHeight;
-
-    // clamp x to landscape bounds
-    if (x <= land.front().x) return land.front().y;
-    if (x >= land.back().x) return land.back().y;
+template <typename Opponent>
+bool Game::updateAndPruneOpponentPool(plf::colony<Opponent>& pool, const SDL_FPoint& playerPos, float deltaTime) {
+    // update in parallel: each opponent only touches itself, and its shots go into its chunk's buffer
+    m_opponentScratch.clear();
+    for (Opponent& opp : pool) m_opponentScratch.push_back(&opp);
+    size_t count = m_opponentScratch.size();
+    size_t chunks = JobSystem::getChunkCount(count, OPPONENT_GRAIN);
+    m_opponentGrounded.resize(count);
+    if (m_chunkShots.size() < chunks) m_chunkShots.resize(chunks);
+
+    const float cameraX = m_state.cameraX;
+    parallelFor(count, OPPONENT_GRAIN, [&](size_t begin, size_t end) {
+        std::vector<Projectile>& shots = m_chunkShots[begin / OPPONENT_GRAIN];
+        for (size_t i = begin; i < end; ++i) {
+            Opponent& opp = *static_cast<Opponent*>(m_opponentScratch[i]);
+            opp.storePreviousPosition();
+            if (opp.isAlive()) {
+                opp.update(deltaTime, playerPos, cameraX, m_state, shots); // remember: world width is bigger than screen - height is same
+            }
 
-    for (size_t i = 0; i < land.size() - 1; ++i) {
-        if (x >= land[i].x && x <= land[i + 1].x) {
-            // linear interpolation between land[i] and land[i+1]
-            float t = (x - land[i].x) / (land[i + 1].x - land[i].x);
-            return land[i].y + t * (land[i + 1].y - land[i].y);
+            // new: check if opponent hit landscape
+            SDL_FRect oppBounds = opp.getBounds();
+            float groundY = m_state.terrain.getGroundYAt(oppBounds.x + oppBounds.w / 2.0f);
+            m_opponentGrounded[i] = oppBounds.y + oppBounds.h >= groundY;
         }
-    }
-    return land.back().y; // fallback
-}
+    });
 
-float Game::getBeamVisualEndX(float startX, float beamY, bool goingRight) const {
-    if (m_state.landscape.empty()) {
-        return goingRight ? m_state.worldWidth : 0.0f;
+    // merge in chunk order, which is pool order whatever thread ran each chunk
+    for (size_t c = 0; c < chunks; ++c) {
+        for (const Projectile& shot : m_chunkShots[c]) m_state.projectiles.insert(shot);
+        m_chunkShots[c].clear();
     }
 
-    const auto& land = m_state.landscape;
-
-    if (goingRight) {
-        // find first segment where x >= startX
-        for (size_t i = 0; i < land.size() - 1; ++i) {
-            float x0 = land[i].x;
-            float x1 = land[i + 1].x;
-            if (x1 < startX) continue;
+    size_t i = 0;
+    for (auto opp_iter = pool.begin(); opp_iter != pool.end(); ++i) {
+        Opponent& opp = *opp_iter;
 
-            float y0 = land[i].y;
-            float y1 = land[i + 1].y;
-
-            // if beam is above both points, it passes through
-            if (beamY < y0 && beamY < y1) {
-                continue;
-            }
-
-            // if beam is below or at both, it hits at segment start
-            if (beamY >= y0 && beamY >= y1) {
-                return std::max(startX, x0);
-            }
-
-            // interpolate intersection
-            // find X where the horizontal beam crosses the straight line segment between (x0,y0) and (x1,y1) 
-            if (y1 != y0) {
-                float t = (beamY - y0) / (y1 - y0);
-                if (t >= 0.0f && t <= 1.0f) {
-                    float intersectX = x0 + t * (x1 - x0);
-                    if (intersectX >= startX) {
-                        return intersectX;
-                    }
+        if (m_opponentGrounded[i]) {
+            if (Opponent::DAMAGES_WORLD) { // only basic opponents damage world
+                m_state.worldHealth--;
+                if (m_state.worldHealth <= 0) {
+                    // world health too low; game over
+                    endGame();
+                    return false; // exit early if world health too low
                 }
             }
-        }
-        return m_state.worldWidth;
-    } else {
-        // going left
-        for (size_t i = land.size() - 1; i > 0; --i) {
-            float x0 = land[i - 1].x;
-            float x1 = land[i].x;
-            if (x0 > startX) continue;
-
-            float y0 = land[i - 1].y;
-            float y1 = land[i].y;
+            // opponent touched ground - explode
+            explodeOpponent(opp);
+            opp_iter = pool.erase(opp_iter);
 
-            if (beamY < y0 && beamY < y1) {
-                continue;
-            }
-            if (beamY >= y0 && beamY >= y1) {
-                return std::min(startX, x1);
-            }
+            continue;
+        }
 
-            if (y1 != y0) {
-                float t = (beamY - y0) / (y1 - y0);
-                if (t >= 0.0f && t <= 1.0f) {
-                    float intersectX = x0 + t * (x1 - x0);
-                    if (intersectX <= startX) {
-                        return intersectX;
-                    }
-                }
-            }
+        if (!opp.isAlive()) {
+            opp_iter = pool.erase(opp_iter);
+            continue;
         }
-        return 0.0f;
+
+        ++opp_iter;
     }
+    return true;
+}
+
+void Game::updateAndPruneParticles(float deltaTime) {
+    // integrate in SIMD-aligned ranges across the workers, then compact dead particles out on this thread
+    ParticleSystem& particles = m_state.particles;
+    parallelFor(particles.size(), PARTICLE_GRAIN, [&](size_t begin, size_t end) {
+        particles.integrate(deltaTime, begin, end);
+    });
+    particles.compact();
 }
 
 void Game::updateAndPruneHealthItems(float deltaTime) {
@@ -674,7 +701,7 @@ void Game::updateAndPruneHealthItems(float deltaTime) {
         item->update(deltaTime);
 
         // check if item hit the landscape
-        float groundY = getGroundYAt(item->getBounds().x + item->getBounds().w / 2.0f);
+        float groundY = m_state.terrain.getGroundYAt(item->getBounds().x + item->getBounds().w / 2.0f);
         float itemBottom = item->getBounds().y + item->getBounds().h;
         if (itemBottom >= groundY && !item->isBlinking()) {
             item->startBlinking();
@@ -704,7 +731,7 @@ void Game::keepPlayerInBounds(SDL_FRect& pb) {
 
     // landscape constraint (bottom)
     float playerBottomX = desiredX + pb.w / 2.0f; 
-    float groundYAtPlayerX = getGroundYAt(playerBottomX);
+    float groundYAtPlayerX = m_state.terrain.getGroundYAt(playerBottomX);
     float absoluteWorldBottom = m_state.worldHeight - pb.h; // absolute bottom of the world
 
     // player's bottom Y should not exceed the landscape height at their X position
@@ -1,13 +1,14 @@
 #pragma once
 #include <vector>
 #include <memory>
-#include "../core/sound_manager.h"
+#include "../core/job_system.h"
+#include "../core/sound_sink.h"
+#include "../core/random.h"
+#include "../core/spatial_grid.h"
+#include "../core/terrain.h"
 #include "../entities/player.h"
 #include "../entities/health_item.h"
-#include "../entities/opponents/base_opponent.h"
-#include "../entities/opponents/basic_opponent.h"
-#include "../entities/opponents/aggressive_opponent.h"
-#include "../entities/opponents/sniper_opponent.h"
+#include "../entities/opponents/opponent_pools.h"
 #include "../plf/plf_colony.h" 
 
 struct GameInput {
@@ -54,6 +55,7 @@ struct GameStateData {
     int worldHealth;
     int playerScore;
     float cameraX;
+    float previousCameraX; // at the end of the previous tick, for render interpolation
     float worldWidth;  // world width goes beyond window
     float worldHeight; // height depends on window size
     float screenWidth; 
@@ -61,8 +63,9 @@ struct GameStateData {
 
     // entities
     std::unique_ptr<Player> player;
-    plf::colony<Particle> particles;
-    plf::colony<std::unique_ptr<BaseOpponent>> opponents;
+    ParticleSystem particles;
+    OpponentPools opponents;
+    plf::colony<Projectile> projectiles; // player beams and opponent shots, told apart by faction
     plf::colony<std::unique_ptr<HealthItem>> healthItems;
 
     // ui state (needed for menus)
@@ -70,46 +73,117 @@ struct GameStateData {
     int highScoreIndex = -1;
     std::string highScoreNameInput;
 
-    std::vector<SDL_FPoint> landscape;
+    Terrain terrain;
 };
 
 class Game {
 public:
-    Game();
+    explicit Game(uint64_t seed);
     ~Game() = default;
 
+    // same seed + same input stream = same game, tick for tick
+    void setSeed(uint64_t seed);
+    uint64_t getSeed() const { return m_seed; }
+
+    // wider worlds only cost more memory in the chunks that are actually on screen;
+    // applies from the next startNewGame()
+    void setWorldWidth(float width) { m_state.worldWidth = width; }
+
     void startNewGame();
     void update(float deltaTime);
+    // one tick is handleInput() then update(); handleInput() first records where
+    // the player and camera were, so a renderer can interpolate from there
     void handleInput(const GameInput& input, float deltaTime);
     const GameStateData& getState() const { return m_state; }
     GameStateData& getState() { return m_state; } 
 
+    // audio side effects go through the sink; nullptr (headless) plays nothing
+    void setSoundSink(SoundSink* sink) { m_soundSink = sink; }
+
+    // entity updates are split across the job system's workers; nullptr runs them
+    // inline. results are identical either way (see parallelFor)
+    void setJobSystem(JobSystem* jobs) { m_jobs = jobs; }
+
+    // replays run against the recorded table and must not overwrite the real one
+    void setSaveHighScores(bool save) { m_saveHighScores = save; }
+
     void submitHighScore(const std::string& name);
     void loadHighScores();
     void saveHighScores();
 
 private:
+    friend class GameBench; // tools/defender_bench.cpp times private passes directly
+
     GameStateData m_state;
+
+    // gameplay (spawns, AI) and cosmetic (particles) randomness are separate streams,
+    // so effects can change without changing how a game plays out
+    uint64_t m_seed = 0;
+    Rng m_rng;
+    Rng m_fxRng;
     float m_lastWindowHeight = 0.0f;
     float m_opponentSpawnTimer;
     const float OPPONENT_SPAWN_INTERVAL = 2.0f;
     bool m_prevShootState = false;
+    float m_backspaceCooldown = 0.0f; // high score name entry
+    bool m_saveHighScores = true;
 
     float m_playerHealthItemSpawnTimer = 0.0f;
     float m_worldHealthItemSpawnTimer = 0.0f;
     const float PLAYER_HEALTH_ITEM_SPAWN_INTERVAL = 17.0f;
     const float WORLD_HEALTH_ITEM_SPAWN_INTERVAL = 36.0f;
 
-    MIX_Mixer* m_mixer;
+    SoundSink* m_soundSink = nullptr;
+    void playSound(SoundEffect effect);
+
+    // items per job. fixed, so chunk boundaries (and the order per-chunk results are
+    // merged in) never depend on how many threads there are
+    static constexpr size_t OPPONENT_GRAIN = 32;
+    static constexpr size_t PROJECTILE_GRAIN = 256;
+    static constexpr size_t PARTICLE_GRAIN = 4096;
+    static_assert(PARTICLE_GRAIN % ParticleSystem::RANGE_ALIGNMENT == 0, "particle jobs must start on a SIMD boundary");
+
+    JobSystem* m_jobs = nullptr;
+    void parallelFor(size_t count, size_t grain, const JobSystem::RangeFn& fn);
+    uint64_t nextSeed(); // 64 bits from the gameplay stream
 
-    void setLandscape();
+    // parallel update scratch
+    std::vector<BaseOpponent*> m_opponentScratch;
+    std::vector<uint8_t> m_opponentGrounded;
+    std::vector<std::vector<Projectile>> m_chunkShots; // shots fired, per opponent chunk
+    std::vector<Projectile*> m_projectileScratch;
+
+    std::vector<float> m_groundQueryX; // batch ground query scratch
+    std::vector<float> m_groundQueryY;
 
     void spawnHealthItem(HealthItemType type);
     void updateAndPruneHealthItems(float deltaTime);
 
     void updateCamera();
     void checkCollisions();
+    void buildCollisionGrids();
+    void endGame();
     void spawnOpponent();
+    void explodeOpponent(const BaseOpponent& opponent);
+
+    // broadphase, rebuilt every tick by buildCollisionGrids(); bounds are cached
+    // because nothing moves while collisions are resolved
+    using HealthItemIterator = plf::colony<std::unique_ptr<HealthItem>>::iterator;
+    struct OpponentRef {
+        BaseOpponent* opponent;
+        OpponentType type; // which pool to erase it from
+        SDL_FRect bounds;
+    };
+    struct HealthItemRef {
+        HealthItemIterator it;
+        SDL_FRect bounds;
+    };
+    const float COLLISION_CELL_SIZE = 64.0f;
+    SpatialGrid m_opponentGrid;
+    SpatialGrid m_healthItemGrid;
+    std::vector<OpponentRef> m_opponentRefs;
+    std::vector<HealthItemRef> m_healthItemRefs;
+    std::vector<uint32_t> m_gridHits; // query scratch
 
     bool isHighScore(int score) const;
     int getHighScoreIndex(int score) const;
@@ -117,9 +191,12 @@ private:
     // helpers
     bool rectsIntersect(const SDL_FRect& a, const SDL_FRect& b) const;
     bool isOutOfWorld(const SDL_FRect& r, float mx = 100.0f, float my = 100.0f) const;
-    void updateAndPruneProjectiles(plf::colony<Projectile>& proj, float deltaTime);
+    void updateAndPruneProjectiles(float deltaTime);
+    bool updateAndPruneOpponents(const SDL_FRect& playerBounds, float deltaTime); // false once the world is destroyed
+    template <typename Opponent>
+    bool updateAndPruneOpponentPool(plf::colony<Opponent>& pool, const SDL_FPoint& playerPos, float deltaTime);
+    template <typename Opponent>
+    void addOpponentsToGrid(plf::colony<Opponent>& pool);
     void updateAndPruneParticles(float deltaTime);
-    float getGroundYAt(float x) const; // for landscape
-    float getBeamVisualEndX(float startX, float beamY, bool goingRight) const; // landscape stops player's beam
     void keepPlayerInBounds(SDL_FRect& pb);
 };
\ No newline at end of file
@@ -0,0 +1,32 @@
+#include "geometry_batch.h"
+
+void GeometryBatch::reserve(size_t quads) {
+    m_vertices.reserve(quads * 4);
+}
+
+void GeometryBatch::addQuad(const SDL_FRect& dst, const SDL_FRect& uv, const SDL_FColor& color) {
+    float x1 = dst.x + dst.w;
+    float y1 = dst.y + dst.h;
+    float u1 = uv.x + uv.w;
+    float v1 = uv.y + uv.h;
+
+    m_vertices.push_back({{dst.x, dst.y}, color, {uv.x, uv.y}});
+    m_vertices.push_back({{x1, dst.y}, color, {u1, uv.y}});
+    m_vertices.push_back({{x1, y1}, color, {u1, v1}});
+    m_vertices.push_back({{dst.x, y1}, color, {uv.x, v1}});
+}
+
+void GeometryBatch::flush(SDL_Renderer* renderer, SDL_Texture* texture) {
+    if (m_vertices.empty()) return;
+
+    size_t quads = m_vertices.size() / 4;
+    for (size_t q = m_indices.size() / 6; q < quads; ++q) {
+        int base = static_cast<int>(q * 4);
+        m_indices.insert(m_indices.end(), {base, base + 1, base + 2, base, base + 2, base + 3});
+    }
+
+    if (!SDL_RenderGeometry(renderer, texture, m_vertices.data(), static_cast<int>(m_vertices.size()), m_indices.data(), static_cast<int>(quads * 6))) {
+        SDL_Log("GeometryBatch: SDL_RenderGeometry failed: %s", SDL_GetError());
+    }
+    m_vertices.clear();
+}
@@ -0,0 +1,26 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <vector>
+
+// quads collected over a frame and submitted with one SDL_RenderGeometry call.
+// buffers keep their capacity between flushes, so a warmed-up batch doesn't allocate
+class GeometryBatch {
+public:
+    void reserve(size_t quads);
+
+    // uv is in normalized texture coordinates
+    void addQuad(const SDL_FRect& dst, const SDL_FRect& uv, const SDL_FColor& color);
+    // untextured (flush with a null texture)
+    void addRect(const SDL_FRect& dst, const SDL_FColor& color) { addQuad(dst, {0.0f, 0.0f, 0.0f, 0.0f}, color); }
+
+    // draws everything queued so far and empties the batch
+    void flush(SDL_Renderer* renderer, SDL_Texture* texture);
+    void clear() { m_vertices.clear(); }
+
+    bool empty() const { return m_vertices.empty(); }
+    size_t getQuadCount() const { return m_vertices.size() / 4; }
+
+private:
+    std::vector<SDL_Vertex> m_vertices;
+    std::vector<int> m_indices; // the same two-triangle pattern for every quad, only ever grows
+};
@@ -0,0 +1,9 @@
+#include "height_field.h"
+
+void HeightField::build(float originX, float step, const float* samples, size_t count) {
+    m_originX = originX;
+    m_step = step;
+    m_invStep = 1.0f / step;
+    m_samples.assign(samples, samples + count);
+    m_lastIndex = count > 0 ? static_cast<float>(count - 1) : 0.0f;
+}
@@ -0,0 +1,34 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+
+// ground heights at evenly spaced x, so a ground query is O(1) (index + lerp)
+class HeightField {
+public:
+    // samples `step` world units apart, the first one at originX
+    void build(float originX, float step, const float* samples, size_t count);
+    void clear() { m_samples.clear(); }
+    bool empty() const { return m_samples.empty(); }
+
+    float getMinX() const { return m_originX; }
+    float getMaxX() const { return m_originX + (m_samples.size() - 1) * m_step; }
+    size_t getSampleCount() const { return m_samples.size(); }
+    float getSample(size_t i) const { return m_samples[i]; }
+
+    // ground y at x, clamped to the end samples outside [minX, maxX]
+    float sample(float x) const {
+        float f = (x - m_originX) * m_invStep;
+        if (f <= 0.0f) return m_samples.front();
+        if (f >= m_lastIndex) return m_samples.back();
+        size_t i = static_cast<size_t>(f);
+        float t = f - static_cast<float>(i);
+        return m_samples[i] + t * (m_samples[i + 1] - m_samples[i]);
+    }
+
+private:
+    float m_originX = 0.0f;
+    float m_step = 1.0f;
+    float m_invStep = 1.0f;
+    float m_lastIndex = 0.0f; // index of the last sample, as float
+    std::vector<float> m_samples;
+};
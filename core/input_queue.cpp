@@ -0,0 +1,73 @@
+#include "input_queue.h"
+
+void InputQueue::push(const std::vector<InputEvent>& events) {
+    if (events.empty()) return;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_events.insert(m_events.end(), events.begin(), events.end());
+}
+
+GameInput InputQueue::takeTick(Uint64 tickDueNs) {
+    GameInput input{};
+    m_pressedThisTick.reset();
+    m_releaseAfterTick.reset();
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        size_t taken = 0;
+        for (; taken < m_events.size(); ++taken) {
+            const InputEvent& event = m_events[taken];
+            if (event.timestampNs > tickDueNs) break;
+
+            // a second edge of the same kind waits for the next tick (as does everything after it)
+            bool full = false;
+            switch (event.type) {
+                case InputEvent::Type::QUIT:
+                    input.quit = true;
+                    break;
+                case InputEvent::Type::ESCAPE:
+                    full = input.escape;
+                    input.escape = true;
+                    break;
+                case InputEvent::Type::ENTER:
+                    full = input.enter;
+                    input.enter = true;
+                    break;
+                case InputEvent::Type::MOUSE_CLICK:
+                    full = input.mouseClick;
+                    if (full) break;
+                    input.mouseClick = true;
+                    input.mouseX = event.mouseX;
+                    input.mouseY = event.mouseY;
+                    break;
+                case InputEvent::Type::CHAR:
+                    full = input.charInputEvent;
+                    if (full) break;
+                    input.charInputEvent = true;
+                    input.inputChar = event.inputChar;
+                    break;
+                case InputEvent::Type::KEY_DOWN:
+                    m_held.set(event.scancode);
+                    m_pressedThisTick.set(event.scancode);
+                    m_releaseAfterTick.reset(event.scancode);
+                    break;
+                case InputEvent::Type::KEY_UP:
+                    if (m_pressedThisTick.test(event.scancode)) m_releaseAfterTick.set(event.scancode);
+                    else m_held.reset(event.scancode);
+                    break;
+            }
+            if (full) break;
+        }
+        m_events.erase(m_events.begin(), m_events.begin() + taken);
+    }
+
+    input.moveLeft  = m_held[SDL_SCANCODE_LEFT] || m_held[SDL_SCANCODE_A];
+    input.moveRight = m_held[SDL_SCANCODE_RIGHT] || m_held[SDL_SCANCODE_D];
+    input.moveUp    = m_held[SDL_SCANCODE_UP] || m_held[SDL_SCANCODE_W];
+    input.moveDown  = m_held[SDL_SCANCODE_DOWN] || m_held[SDL_SCANCODE_S];
+    input.shoot     = m_held[SDL_SCANCODE_SPACE];
+    input.boost     = m_held[SDL_SCANCODE_C] || m_held[SDL_SCANCODE_LSHIFT] || m_held[SDL_SCANCODE_RSHIFT];
+    input.backspacePressed = m_held[SDL_SCANCODE_BACKSPACE] || m_held[SDL_SCANCODE_DELETE];
+
+    m_held &= ~m_releaseAfterTick;
+    return input;
+}
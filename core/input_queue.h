@@ -0,0 +1,54 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <bitset>
+#include <mutex>
+#include <vector>
+#include "game.h"
+
+// one input event as the main thread saw it, stamped with SDL's event time
+// (the SDL_GetTicksNS clock)
+struct InputEvent {
+    enum class Type : Uint8 {
+        QUIT,
+        ESCAPE,
+        ENTER,
+        MOUSE_CLICK,
+        CHAR,
+        KEY_DOWN, // held keys, by scancode
+        KEY_UP
+    };
+
+    Uint64 timestampNs = 0;
+    Type type = Type::QUIT;
+    SDL_Scancode scancode = SDL_SCANCODE_UNKNOWN;
+    int mouseX = 0;
+    int mouseY = 0;
+    char inputChar = 0;
+};
+
+// carries input from the main thread, which gathers events once per frame, to
+// the simulation thread, which hands each tick the events that happened before
+// that tick was due. catch-up ticks after a stall therefore each get their own
+// slice of the input instead of the first one getting all of it.
+// nothing is dropped: a tick takes at most one of each edge (click, character,
+// escape, enter) and leaves the next one for the following tick, and a key
+// pressed and released within one tick still reads as held for that tick
+class InputQueue {
+public:
+    // main thread, once per frame; events must be in timestamp order
+    void push(const std::vector<InputEvent>& events);
+
+    // simulation thread, once per tick: everything stamped up to tickDueNs
+    GameInput takeTick(Uint64 tickDueNs);
+
+private:
+    using KeySet = std::bitset<SDL_SCANCODE_COUNT>;
+
+    std::mutex m_mutex;
+    std::vector<InputEvent> m_events; // guarded by m_mutex, oldest first
+
+    // simulation thread only
+    KeySet m_held;
+    KeySet m_pressedThisTick;
+    KeySet m_releaseAfterTick; // released in the tick they were pressed in
+};
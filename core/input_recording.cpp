@@ -0,0 +1,241 @@
+#include "input_recording.h"
+#include <SDL3/SDL.h>
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include "binary_io.h"
+
+using namespace BinaryIO;
+
+namespace {
+    const char MAGIC[4] = { 'S', 'D', 'R', 'P' };
+    const uint16_t VERSION = 2; // 2 added the tick rate; version 1 files ran at 60
+    const size_t BUFFER_FLUSH_BYTES = 64 * 1024;
+
+    // one bit per GameInput flag, plus RESIZED for records that carry a new screen size
+    enum : uint16_t {
+        MOVE_LEFT   = 1 << 0,
+        MOVE_RIGHT  = 1 << 1,
+        MOVE_UP     = 1 << 2,
+        MOVE_DOWN   = 1 << 3,
+        SHOOT       = 1 << 4,
+        BOOST       = 1 << 5,
+        QUIT        = 1 << 6,
+        ESCAPE      = 1 << 7,
+        ENTER       = 1 << 8,
+        MOUSE_CLICK = 1 << 9,  // followed by mouseX, mouseY
+        CHAR_INPUT  = 1 << 10, // followed by inputChar
+        BACKSPACE   = 1 << 11,
+        RESIZED     = 1 << 12  // followed by screenWidth, screenHeight
+    };
+    // records carrying any of these cover exactly one tick
+    const uint16_t EVENT_FLAGS = MOUSE_CLICK | CHAR_INPUT | RESIZED;
+
+    uint16_t packFlags(const GameInput& input) {
+        uint16_t flags = 0;
+        if (input.moveLeft) flags |= MOVE_LEFT;
+        if (input.moveRight) flags |= MOVE_RIGHT;
+        if (input.moveUp) flags |= MOVE_UP;
+        if (input.moveDown) flags |= MOVE_DOWN;
+        if (input.shoot) flags |= SHOOT;
+        if (input.boost) flags |= BOOST;
+        if (input.quit) flags |= QUIT;
+        if (input.escape) flags |= ESCAPE;
+        if (input.enter) flags |= ENTER;
+        if (input.mouseClick) flags |= MOUSE_CLICK;
+        if (input.charInputEvent) flags |= CHAR_INPUT;
+        if (input.backspacePressed) flags |= BACKSPACE;
+        return flags;
+    }
+
+    GameInput unpackFlags(uint16_t flags) {
+        GameInput input{};
+        input.moveLeft = flags & MOVE_LEFT;
+        input.moveRight = flags & MOVE_RIGHT;
+        input.moveUp = flags & MOVE_UP;
+        input.moveDown = flags & MOVE_DOWN;
+        input.shoot = flags & SHOOT;
+        input.boost = flags & BOOST;
+        input.quit = flags & QUIT;
+        input.escape = flags & ESCAPE;
+        input.enter = flags & ENTER;
+        input.mouseClick = flags & MOUSE_CLICK;
+        input.charInputEvent = flags & CHAR_INPUT;
+        input.backspacePressed = flags & BACKSPACE;
+        return input;
+    }
+}
+
+// recorder
+InputRecorder::~InputRecorder() {
+    close();
+}
+
+bool InputRecorder::open(const std::string& path, const RecordingHeader& header) {
+    close();
+    m_file.open(path, std::ios::binary | std::ios::trunc);
+    if (!m_file.is_open()) {
+        SDL_Log("InputRecorder: Failed to open '%s' for writing", path.c_str());
+        return false;
+    }
+    m_path = path;
+    m_pending = Record{};
+    m_lastWidth = header.screenWidth;
+    m_lastHeight = header.screenHeight;
+    m_tickCount = 0;
+
+    m_buffer.clear();
+    m_buffer.insert(m_buffer.end(), std::begin(MAGIC), std::end(MAGIC));
+    putU16(m_buffer, VERSION);
+    putU64(m_buffer, header.seed);
+    putF32(m_buffer, header.worldWidth);
+    putI32(m_buffer, header.screenWidth);
+    putI32(m_buffer, header.screenHeight);
+    putU16(m_buffer, static_cast<uint16_t>(header.tickRate));
+    putU8(m_buffer, static_cast<uint8_t>(header.highScores.size()));
+    for (const auto& entry : header.highScores) {
+        size_t length = std::min<size_t>(entry.name.size(), 255);
+        putU8(m_buffer, static_cast<uint8_t>(length));
+        m_buffer.insert(m_buffer.end(), entry.name.begin(), entry.name.begin() + length);
+        putI32(m_buffer, entry.score);
+    }
+    return true;
+}
+
+void InputRecorder::record(const GameInput& input, int screenWidth, int screenHeight) {
+    if (!m_file.is_open()) return;
+    ++m_tickCount;
+
+    uint16_t flags = packFlags(input);
+    if (screenWidth != m_lastWidth || screenHeight != m_lastHeight) {
+        flags |= RESIZED;
+        m_lastWidth = screenWidth;
+        m_lastHeight = screenHeight;
+    }
+
+    // held keys just extend the pending run
+    if (m_pending.repeat > 0 && m_pending.repeat < UINT16_MAX && flags == m_pending.flags && !(flags & EVENT_FLAGS)) {
+        ++m_pending.repeat;
+        return;
+    }
+
+    flushPending();
+    m_pending.flags = flags;
+    m_pending.repeat = 1;
+    m_pending.mouseX = input.mouseX;
+    m_pending.mouseY = input.mouseY;
+    m_pending.inputChar = input.inputChar;
+    m_pending.screenWidth = screenWidth;
+    m_pending.screenHeight = screenHeight;
+}
+
+void InputRecorder::close() {
+    if (!m_file.is_open()) return;
+    flushPending();
+    flushBuffer();
+    m_file.close();
+    SDL_Log("InputRecorder: Wrote %llu ticks to '%s'", static_cast<unsigned long long>(m_tickCount), m_path.c_str());
+}
+
+void InputRecorder::flushPending() {
+    if (m_pending.repeat == 0) return;
+    putU16(m_buffer, m_pending.flags);
+    putU16(m_buffer, m_pending.repeat);
+    if (m_pending.flags & MOUSE_CLICK) {
+        putI32(m_buffer, m_pending.mouseX);
+        putI32(m_buffer, m_pending.mouseY);
+    }
+    if (m_pending.flags & CHAR_INPUT) putU8(m_buffer, static_cast<uint8_t>(m_pending.inputChar));
+    if (m_pending.flags & RESIZED) {
+        putI32(m_buffer, m_pending.screenWidth);
+        putI32(m_buffer, m_pending.screenHeight);
+    }
+    m_pending.repeat = 0;
+
+    if (m_buffer.size() >= BUFFER_FLUSH_BYTES) flushBuffer();
+}
+
+void InputRecorder::flushBuffer() {
+    m_file.write(reinterpret_cast<const char*>(m_buffer.data()), static_cast<std::streamsize>(m_buffer.size()));
+    m_buffer.clear();
+}
+// END: recorder
+
+// replay
+bool InputReplay::open(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        SDL_Log("InputReplay: Failed to open '%s'", path.c_str());
+        return false;
+    }
+    m_data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    m_pos = 0;
+    m_remaining = 0;
+
+    if (m_data.size() < sizeof(MAGIC) || std::memcmp(m_data.data(), MAGIC, sizeof(MAGIC)) != 0) {
+        SDL_Log("InputReplay: '%s' is not an input recording", path.c_str());
+        return false;
+    }
+    m_pos = sizeof(MAGIC);
+
+    Reader in{m_data.data(), m_data.size(), m_pos};
+    uint16_t version = in.u16();
+    if (in.ok && (version == 0 || version > VERSION)) {
+        SDL_Log("InputReplay: '%s' has unsupported version %u", path.c_str(), static_cast<unsigned>(version));
+        return false;
+    }
+    m_header = RecordingHeader{};
+    m_header.seed = in.u64();
+    m_header.worldWidth = in.f32();
+    m_header.screenWidth = in.i32();
+    m_header.screenHeight = in.i32();
+    m_header.tickRate = version >= 2 ? in.u16() : 60;
+    if (in.ok && m_header.tickRate == 0) {
+        SDL_Log("InputReplay: '%s' has a zero tick rate", path.c_str());
+        return false;
+    }
+    int highScoreCount = in.u8();
+    for (int i = 0; i < highScoreCount && in.ok; ++i) {
+        GameStateData::HighScore entry;
+        entry.name = in.str(in.u8());
+        entry.score = in.i32();
+        m_header.highScores.push_back(entry);
+    }
+    if (!in.ok) {
+        SDL_Log("InputReplay: '%s' has a truncated header", path.c_str());
+        return false;
+    }
+    m_pos = in.pos;
+
+    m_screenWidth = m_header.screenWidth;
+    m_screenHeight = m_header.screenHeight;
+    return true;
+}
+
+bool InputReplay::next(GameInput& input, int& screenWidth, int& screenHeight) {
+    if (m_remaining == 0) {
+        Reader in{m_data.data(), m_data.size(), m_pos};
+        uint16_t flags = in.u16();
+        uint16_t repeat = in.u16();
+        m_current = unpackFlags(flags);
+        if (flags & MOUSE_CLICK) {
+            m_current.mouseX = in.i32();
+            m_current.mouseY = in.i32();
+        }
+        if (flags & CHAR_INPUT) m_current.inputChar = static_cast<char>(in.u8());
+        if (flags & RESIZED) {
+            m_screenWidth = in.i32();
+            m_screenHeight = in.i32();
+        }
+        if (!in.ok || repeat == 0) return false;
+        m_pos = in.pos;
+        m_remaining = repeat;
+    }
+
+    input = m_current;
+    screenWidth = m_screenWidth;
+    screenHeight = m_screenHeight;
+    --m_remaining;
+    return true;
+}
+// END: replay
@@ -0,0 +1,80 @@
+#pragma once
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "game.h"
+#include "config.h"
+
+// everything besides the input stream that a session depends on, written once
+// at the start of a recording
+struct RecordingHeader {
+    uint64_t seed = 0;
+    float worldWidth = 0.0f;
+    int screenWidth = 0;
+    int screenHeight = 0;
+    int tickRate = Config::Timing::TICK_RATE; // every tick advances the game by 1 / tickRate
+    std::vector<GameStateData::HighScore> highScores; // decides whether name entry comes up
+};
+
+// writes the per-tick GameInput stream to a compact binary file.
+// consecutive identical ticks are run-length encoded, and mouse position, typed
+// characters and window size are only stored on the ticks where they matter, so
+// a typical session costs a few bytes per change of input rather than per tick
+class InputRecorder {
+public:
+    InputRecorder() = default;
+    ~InputRecorder();
+    InputRecorder(const InputRecorder&) = delete;
+    InputRecorder& operator=(const InputRecorder&) = delete;
+
+    bool open(const std::string& path, const RecordingHeader& header);
+    // one call per fixed tick, with the screen size that tick ran at
+    void record(const GameInput& input, int screenWidth, int screenHeight);
+    void close();
+
+    bool isOpen() const { return m_file.is_open(); }
+    uint64_t getTickCount() const { return m_tickCount; }
+
+private:
+    std::ofstream m_file;
+    std::string m_path;
+    std::vector<uint8_t> m_buffer;
+
+    struct Record {
+        uint16_t flags = 0;
+        uint16_t repeat = 0; // ticks this record covers; 0 = nothing pending
+        int mouseX = 0;
+        int mouseY = 0;
+        char inputChar = 0;
+        int screenWidth = 0;
+        int screenHeight = 0;
+    };
+    Record m_pending;
+    int m_lastWidth = 0;
+    int m_lastHeight = 0;
+    uint64_t m_tickCount = 0;
+
+    void flushPending();
+    void flushBuffer();
+};
+
+// reads a file written by InputRecorder back one tick at a time
+class InputReplay {
+public:
+    bool open(const std::string& path);
+    const RecordingHeader& getHeader() const { return m_header; }
+
+    // false once the recording is exhausted
+    bool next(GameInput& input, int& screenWidth, int& screenHeight);
+
+private:
+    RecordingHeader m_header;
+    std::vector<uint8_t> m_data;
+    size_t m_pos = 0;
+
+    GameInput m_current;
+    uint32_t m_remaining = 0; // ticks left on m_current
+    int m_screenWidth = 0;
+    int m_screenHeight = 0;
+};
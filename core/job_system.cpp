@@ -0,0 +1,101 @@
+#include "job_system.h"
+#include <algorithm>
+
+JobSystem::JobSystem(int workerCount) {
+    workerCount = std::max(0, workerCount);
+    for (int i = 0; i <= workerCount; ++i) {
+        m_deques.push_back(std::make_unique<Deque>());
+    }
+    for (int i = 0; i < workerCount; ++i) {
+        m_workers.emplace_back(&JobSystem::workerLoop, this, static_cast<size_t>(i + 1));
+    }
+}
+
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+        m_stop = true;
+    }
+    m_wake.notify_all();
+    for (std::thread& worker : m_workers) {
+        worker.join();
+    }
+}
+
+int JobSystem::getDefaultWorkerCount() {
+    unsigned int hardware = std::thread::hardware_concurrency();
+    return hardware > 1 ? static_cast<int>(hardware) - 1 : 0;
+}
+
+void JobSystem::parallelFor(size_t count, size_t grain, const RangeFn& fn) {
+    if (count == 0) return;
+    grain = std::max<size_t>(grain, 1);
+
+    // nothing to share: skip the queues entirely
+    if (m_workers.empty() || count <= grain) {
+        for (size_t begin = 0; begin < count; begin += grain) {
+            fn(begin, std::min(begin + grain, count));
+        }
+        return;
+    }
+
+    // counted before they're queued, so a claim can never run the counters below zero
+    size_t chunks = getChunkCount(count, grain);
+    m_unfinished.fetch_add(chunks, std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+        m_unclaimed.fetch_add(chunks, std::memory_order_relaxed);
+    }
+
+    // deal chunks round-robin so every deque starts with a share
+    for (size_t chunk = 0; chunk < chunks; ++chunk) {
+        Deque& deque = *m_deques[chunk % m_deques.size()];
+        size_t begin = chunk * grain;
+        std::lock_guard<std::mutex> lock(deque.mutex);
+        deque.tasks.push_back({ &fn, begin, std::min(begin + grain, count) });
+    }
+    m_wake.notify_all();
+
+    // help out, then wait for the chunks other threads are still running
+    while (runOne(0)) {}
+    while (m_unfinished.load(std::memory_order_acquire) != 0) {
+        std::this_thread::yield();
+    }
+}
+
+bool JobSystem::runOne(size_t self) {
+    Task task{};
+    bool found = false;
+
+    // own deque from the back (most recently dealt, still warm), then steal from the front of the others
+    for (size_t n = 0; n < m_deques.size() && !found; ++n) {
+        Deque& deque = *m_deques[(self + n) % m_deques.size()];
+        std::lock_guard<std::mutex> lock(deque.mutex);
+        if (deque.tasks.empty()) continue;
+        if (n == 0) {
+            task = deque.tasks.back();
+            deque.tasks.pop_back();
+        } else {
+            task = deque.tasks.front();
+            deque.tasks.pop_front();
+        }
+        found = true;
+    }
+    if (!found) return false;
+
+    m_unclaimed.fetch_sub(1, std::memory_order_relaxed);
+    (*task.fn)(task.begin, task.end);
+    m_unfinished.fetch_sub(1, std::memory_order_release);
+    return true;
+}
+
+void JobSystem::workerLoop(size_t self) {
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(m_wakeMutex);
+            m_wake.wait(lock, [this] { return m_stop || m_unclaimed.load(std::memory_order_acquire) > 0; });
+            if (m_stop) return;
+        }
+        while (runOne(self)) {}
+    }
+}
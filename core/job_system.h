@@ -0,0 +1,58 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// fixed pool of worker threads, each with its own work-stealing deque.
+// parallelFor() cuts [0, count) into chunks of `grain` items and deals them out;
+// workers pop from the back of their own deque and steal from the front of the
+// others', and the calling thread works through chunks too until all are done.
+// chunk boundaries depend only on count and grain, never on the number of
+// threads, so callers that merge per-chunk results in chunk order get the same
+// answer with 0 workers as with 15
+class JobSystem {
+public:
+    using RangeFn = std::function<void(size_t begin, size_t end)>;
+
+    explicit JobSystem(int workerCount); // 0 runs everything on the calling thread
+    ~JobSystem();
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    int getWorkerCount() const { return static_cast<int>(m_workers.size()); }
+    static int getDefaultWorkerCount(); // one per hardware thread, minus the caller's
+
+    // blocks until fn has run on every chunk; not reentrant (no parallelFor inside fn)
+    void parallelFor(size_t count, size_t grain, const RangeFn& fn);
+
+    static size_t getChunkCount(size_t count, size_t grain) { return (count + grain - 1) / grain; }
+
+private:
+    struct Task {
+        const RangeFn* fn;
+        size_t begin;
+        size_t end;
+    };
+    struct Deque {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    std::vector<std::thread> m_workers;
+    std::vector<std::unique_ptr<Deque>> m_deques; // [0] belongs to the caller, [i + 1] to worker i
+
+    std::mutex m_wakeMutex;
+    std::condition_variable m_wake;
+    std::atomic<size_t> m_unclaimed{0}; // queued, not yet picked up
+    std::atomic<size_t> m_unfinished{0}; // queued or running
+    bool m_stop = false; // guarded by m_wakeMutex
+
+    bool runOne(size_t self);
+    void workerLoop(size_t self);
+};
@@ -0,0 +1,29 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// a whole file mapped read-only into memory: one open, one map, no copy. pages
+// are read in by the OS on first touch and shared between processes using the
+// same file. the data stays valid until close() or destruction
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool open(const std::string& path); // false (and logs) if missing, empty or unmappable
+    void close();
+
+    bool isOpen() const { return m_data != nullptr; }
+    const uint8_t* getData() const { return m_data; }
+    size_t getSize() const { return m_size; }
+
+private:
+    const uint8_t* m_data = nullptr;
+    size_t m_size = 0;
+#ifdef _WIN32
+    void* m_mapping = nullptr; // HANDLE
+#endif
+};
@@ -5,7 +5,14 @@
 #include <cctype>
 #include <cstring>
 #include <sstream>
-#include "../entities/health_item.h"
+#include <thread>
+#include "asset_archive.h"
+#include "asset_loader.h"
+#include "profiler.h"
+
+namespace {
+    float lerp(float from, float to, float t) { return from + (to - from) * t; }
+}
 
 Platform::Platform() = default;
 
@@ -41,15 +48,20 @@ bool Platform::initialize() {
     }
 
     // attempt to enable VSync using SDL_SetRenderVSync
-    if (SDL_SetRenderVSync(m_renderer, 1) != 0) { // 1 enables VSync, 0 disables
+    m_vsync = false;
+    if (!m_timing.vsync) {
+        SDL_Log("VSync disabled.");
+    } else if (!SDL_SetRenderVSync(m_renderer, 1)) { // 1 enables VSync, 0 disables
         // if setting VSync fails, log it but continue (maybe VSync isn't supported on this display/driver)
         SDL_Log("Warning: Failed to enable VSync: %s. Running without VSync.", SDL_GetError());
     } else {
+        m_vsync = true;
         SDL_Log("VSync successfully enabled.");
     }
 
     SDL_GetWindowSize(m_window, &m_windowWidth, &m_windowHeight);
 
+
     // audio device initialization
     // define the desired audio format using SDL3 enums
     SDL_AudioSpec desired_spec;
@@ -81,6 +93,12 @@ bool Platform::initialize() {
         SDL_Log("Skipping SoundManager initialization due to audio device failure.");
     }
 
+    // sprites, fonts and sounds, all before the first frame of the game
+    preloadAssets();
+    if (!m_textRenderer.initialize(m_renderer, Config::Fonts::DEFAULT_FONT_FILE)) {
+        SDL_Log("Failed to build glyph atlases, text will not be drawn.");
+    }
+
     return true;
 }
 
@@ -93,8 +111,10 @@ void Platform::shutdown() {
 
     SoundManager::getInstance().shutdown();
 
+    m_textRenderer.shutdown();
     TextureManager::getInstance().clearCache();
     FontManager::getInstance().clearCache();
+    AssetArchive::getInstance().close(); // after the fonts and sounds read from it
 
      //audio device shutdown
     if (m_audioDeviceID) {
@@ -120,64 +140,199 @@ void Platform::shutdown() {
 }
 
 void Platform::run(Game& sim) {
-    const int TARGET_FPS = 60;
-    const float FRAME_TARGET_TIME_MS = 1000.0f / TARGET_FPS;
-    const float FIXED_DELTA_TIME = 1.0f / TARGET_FPS; // delta time for updates
+    if (m_replay) {
+        // play back at the recorded size so menus and camera line up the same way
+        const RecordingHeader& header = m_replay->getHeader();
+        SDL_SetWindowSize(m_window, header.screenWidth, header.screenHeight);
+    }
+    SDL_GetWindowSize(m_window, &m_windowWidth, &m_windowHeight);
+    m_simScreenWidth = m_windowWidth;
+    m_simScreenHeight = m_windowHeight;
 
-    // 64-bit integers for time values
-    Uint64 previousFrameTime = SDL_GetTicks(); // time of previous frame start
-    float accumulator = 0.0f; // accumulates elapsed time to control update frequency
+    // frames are paced by sleeping, never by spinning: VSync alone needs no cap,
+    // anything else is held to the configured (or display) rate, and screens
+    // without gameplay drop to a low rate
+    FramePacer framePacer;
+    const int frameCap = getFrameCap();
+    const int idleFrameCap = frameCap > 0 ? std::min(frameCap, Config::Timing::MENU_FRAME_CAP) : Config::Timing::MENU_FRAME_CAP;
+    SDL_Log("Platform: %d ticks/s, frame cap %d (menus %d)", m_timing.tickRate, frameCap, idleFrameCap);
 
     m_running = true;
+    std::thread simThread(&Platform::simulationLoop, this, std::ref(sim));
+
+    // events and drawing stay here: SDL wants both on the main thread
     while (m_running) {
-        Uint64 currentTime = SDL_GetTicks();
-        float deltaTimeMS = static_cast<float>(currentTime - previousFrameTime);
-        previousFrameTime = currentTime;
+        SDL_GetWindowSize(m_window, &m_windowWidth, &m_windowHeight);
+        m_simScreenWidth = m_windowWidth;
+        m_simScreenHeight = m_windowHeight;
 
-        // prevents "spiral of death" ... if frame takes too long
-        if (deltaTimeMS > 200.0f) 
-            deltaTimeMS = 200.0f; // cap at 200ms (5 FPS)
-        
-        accumulator += deltaTimeMS / 1000.0f; // convert to seconds, add to accumulator
+        pollInput();
 
-        SDL_GetWindowSize(m_window, &m_windowWidth, &m_windowHeight);
+        if (m_snapshots.acquire()) m_hasSnapshot = true;
+        if (m_hasSnapshot) {
+            const RenderSnapshot& snapshot = m_snapshots.front();
+            updateTextInputState(snapshot);
+            render(snapshot);
+        }
+        SDL_RenderPresent(m_renderer); // outside render() so vsync waits don't count as render time
+
+        bool idle = !m_hasSnapshot || m_snapshots.front().state != GameStateData::State::PLAYING;
+        framePacer.setRate(idle ? idleFrameCap : frameCap);
+        framePacer.wait();
+        Profiler::getInstance().endFrame();
+    }
+    simThread.join();
+
+    // ensure text input is stopped when the loop exits
+    if (m_textInputActive) {
+        SDL_StopTextInput(m_window);
+        m_textInputActive = false;
+        SDL_Log("Platform: Text input STOPPED on shutdown.");
+    }
+}
+// END: public usage
 
-        auto& state = sim.getState();
-        state.screenWidth = m_windowWidth;
-        state.screenHeight = m_windowHeight;
+// loading
+void Platform::preloadAssets() {
+    // a shipped build reads everything from the one mapped archive
+    if (!AssetArchive::getInstance().open(Config::Assets::ARCHIVE)) {
+        SDL_Log("Platform: No asset archive, loading loose files.");
+    }
 
-        if (state.state == GameStateData::State::PLAYING) {
-            state.worldHeight = (float)m_windowHeight; // world height depends on window resize (width does not)
+    AssetLoader loader;
+    loader.start(AssetManifest::fromConfig(), m_jobs, SoundManager::getInstance().getMixerInstance(), m_audioSpec);
+
+    // keep the window responsive and show progress while the workers decode
+    FramePacer framePacer;
+    framePacer.setRate(Config::Timing::MENU_FRAME_CAP);
+    bool quit = false;
+    while (!loader.isDone()) {
+        SDL_Event event;
+        while (SDL_PollEvent(&event)) {
+            if (event.type == SDL_EVENT_QUIT) quit = true;
         }
+        SDL_GetWindowSize(m_window, &m_windowWidth, &m_windowHeight);
+        renderLoadingScreen(loader.getProgress());
+        SDL_RenderPresent(m_renderer);
+        framePacer.wait();
+    }
+    renderLoadingScreen(1.0f);
+    SDL_RenderPresent(m_renderer);
+
+    loader.install(m_renderer);
+
+    // closing the window while loading still quits, once the game loop sees it
+    if (quit) {
+        SDL_Event event;
+        SDL_zero(event);
+        event.type = SDL_EVENT_QUIT;
+        event.common.timestamp = SDL_GetTicksNS();
+        SDL_PushEvent(&event);
+    }
+}
 
-        updateTextInputState(state); // update text input state
+void Platform::renderLoadingScreen(float progress) {
+    SDL_SetRenderDrawColor(m_renderer, 0, 20, 40, 255);
+    SDL_RenderClear(m_renderer);
+
+    // no text yet: the fonts are among the things loading
+    const float barWidth = m_windowWidth * 0.5f;
+    const float barHeight = 16.0f;
+    SDL_FRect outline = { (m_windowWidth - barWidth) / 2.0f, (m_windowHeight - barHeight) / 2.0f, barWidth, barHeight };
+    SDL_FRect fill = { outline.x + 2.0f, outline.y + 2.0f, (outline.w - 4.0f) * progress, outline.h - 4.0f };
+    SDL_SetRenderDrawColor(m_renderer, 0, 200, 255, 255);
+    SDL_RenderFillRect(m_renderer, &fill);
+    SDL_SetRenderDrawColor(m_renderer, 200, 200, 200, 255);
+    SDL_RenderRect(m_renderer, &outline);
+}
+// END: loading
+
+// simulation thread
+void Platform::simulationLoop(Game& sim) {
+    const float FIXED_DELTA_TIME = 1.0f / m_timing.tickRate; // delta time for updates
+    const Uint64 TICK_NS = SDL_NS_PER_SECOND / m_timing.tickRate;
+    const Uint64 MAX_BACKLOG_NS = TICK_NS * m_timing.maxCatchUpTicks; // prevents "spiral of death" after a stall
+
+    auto& state = sim.getState();
+    Uint64 previousTime = SDL_GetTicksNS();
+    Uint64 accumulator = 0; // elapsed time not yet simulated
+
+    while (m_running) {
+        Uint64 currentTime = SDL_GetTicksNS();
+        accumulator = std::min(accumulator + (currentTime - previousTime), MAX_BACKLOG_NS);
+        previousTime = currentTime;
 
         // fixed timestep update loop
-        while (accumulator >= FIXED_DELTA_TIME) {
-            GameInput input = pollInput(state);
+        bool ticked = false;
+        while (accumulator >= TICK_NS && m_running) {
+            state.screenWidth = static_cast<float>(m_simScreenWidth.load());
+            state.screenHeight = static_cast<float>(m_simScreenHeight.load());
+            if (state.state == GameStateData::State::PLAYING) {
+                state.worldHeight = state.screenHeight; // world height depends on window resize (width does not)
+            }
+
+            // this tick covers input up to the moment it became due
+            Uint64 tickDueNs = currentTime - accumulator + TICK_NS;
+            GameInput input = takeInput(state, tickDueNs);
+            if (m_replay) {
+                if (input.quit) m_running = false;
+                int replayWidth = 0;
+                int replayHeight = 0;
+                if (!m_replay->next(input, replayWidth, replayHeight)) {
+                    SDL_Log("Platform: Replay finished.");
+                    m_running = false;
+                    break;
+                }
+                // the game sees the recorded screen size, whatever the window is now
+                state.screenWidth = static_cast<float>(replayWidth);
+                state.screenHeight = static_cast<float>(replayHeight);
+                if (state.state == GameStateData::State::PLAYING) state.worldHeight = state.screenHeight;
+            } else if (m_recorder) {
+                m_recorder->record(input, static_cast<int>(state.screenWidth), static_cast<int>(state.screenHeight));
+            }
             sim.handleInput(input, FIXED_DELTA_TIME);
 
-            if (input.quit || state.running == false) m_running = false;            
+            if (input.quit || state.running == false) m_running = false;
 
             sim.update(FIXED_DELTA_TIME);
-            accumulator -= FIXED_DELTA_TIME;
+            accumulator -= TICK_NS;
+            ticked = true;
         }
 
-        render(state);
+        if (ticked) {
+            RenderSnapshot& snapshot = m_snapshots.back();
+            snapshot.capture(state);
+            snapshot.tickTimeNs = currentTime - accumulator; // the leftover is how far past that tick we already are
+            snapshot.tickDurationNs = TICK_NS;
+            m_snapshots.publish();
+        }
+
+        // sleep until the next tick is due
+        if (accumulator < TICK_NS) SDL_DelayNS(TICK_NS - accumulator);
     }
+}
 
-    // ensure text input is stopped when the loop exits
-    if (m_textInputActive) {
-        SDL_StopTextInput(m_window);
-        m_textInputActive = false;
-        SDL_Log("Platform: Text input STOPPED on shutdown.");
+GameInput Platform::takeInput(const GameStateData& state, Uint64 tickDueNs) {
+    GameInput input = m_inputQueue.takeTick(tickDueNs);
+
+    // only movement/shoot/boost while playing, only backspace on the high score screen
+    if (state.state != GameStateData::State::PLAYING) {
+        input.moveLeft = input.moveRight = input.moveUp = input.moveDown = false;
+        input.shoot = input.boost = false;
+    }
+    if (state.state != GameStateData::State::GAME_OVER || !state.waitingForHighScore) {
+        input.backspacePressed = false;
     }
+    return input;
 }
-// END: public usage
+// END: simulation thread
+
+void Platform::render(const RenderSnapshot& snapshot) {
+    PROFILE_SCOPE(ProfileSection::RENDER);
+    m_alpha = snapshot.getAlpha(SDL_GetTicksNS());
+    m_viewX = lerp(snapshot.previousCameraX, snapshot.cameraX, m_alpha);
 
-void Platform::render(const GameStateData& state) {
-    float cameraOffsetX = state.cameraX;
-    switch (state.state) {
+    switch (snapshot.state) {
         case GameStateData::State::MENU:
             renderMainMenu();
             break;
@@ -188,216 +343,172 @@ void Platform::render(const GameStateData& state) {
             SDL_SetRenderDrawColor(m_renderer, 0, 20, 40, 255);
             SDL_RenderClear(m_renderer);
 
-            // HUD background
-            SDL_SetRenderDrawColor(m_renderer, 0, 30, 50, 220);
-            SDL_FRect hudBg = {0.0f, 0.0f, static_cast<float>(m_windowWidth), static_cast<float>(Config::Game::HUD_HEIGHT)};
-            SDL_RenderFillRect(m_renderer, &hudBg);
-
-            // HUD separator line
-            SDL_SetRenderDrawColor(m_renderer, 200, 200, 200, 255);
-            SDL_RenderLine(m_renderer, 0.0f, static_cast<float>(Config::Game::HUD_HEIGHT), static_cast<float>(m_windowWidth), static_cast<float>(Config::Game::HUD_HEIGHT));
-
-            if (state.player) {
-                // render player
-                auto playerTexture = TextureManager::getInstance().getTexture(Config::Textures::PLAYER, m_renderer);
-                if (playerTexture) {
-                    SDL_FRect renderBounds = state.player->getBounds();
-                    renderBounds.x -= cameraOffsetX;
-                    
-                    // apply flip based on player's facing-direction
-                    SDL_FRect drawRect = renderBounds;
-                    if (state.player->getFacing() == Direction::LEFT) {
-                        drawRect.x += drawRect.w;
-                        drawRect.w = -drawRect.w;
-                    }
-                    SDL_RenderTexture(m_renderer, playerTexture.get(), nullptr, &drawRect);
-
-                    // render player projectiles
-                    const auto& pp = state.player->getProjectiles();
-                    for (const auto& p : pp) {
-                        if (p.getAge() >= p.getLifetime()) continue;
-                        
-                        float beamY = p.getSpawnY();
-                        float startX = p.getSpawnX();
-                        bool goingRight = (p.getVelocity().x > 0);
-
-                        // find visual end point
-                        float rawEndX = goingRight ? state.worldWidth : 0.0f;
-                        float landscapeEndX = findBeamLandscapeIntersection(startX, beamY, goingRight, state.landscape, state.worldWidth);
-
-                        // use the closer endpoint (landscape or world edge)
-                        float endX = goingRight ? std::min(rawEndX, landscapeEndX) : std::max(0.0f, landscapeEndX);
-
-                        SDL_Color color = p.getColor();
-                        SDL_SetRenderDrawColor(m_renderer, color.r, color.g, color.b, color.a);
-                        SDL_RenderLine(m_renderer, startX - cameraOffsetX, beamY, endX - cameraOffsetX,beamY); // render player beam
-                    }
-                }
-            }
-
-            for (const auto& o : state.opponents) {
-                if (!o || !o->isAlive()) continue;
+            {
+                PROFILE_SCOPE(ProfileSection::RENDER_HUD);
+                // HUD background
+                SDL_SetRenderDrawColor(m_renderer, 0, 30, 50, 220);
+                SDL_FRect hudBg = {0.0f, 0.0f, static_cast<float>(m_windowWidth), static_cast<float>(Config::Game::HUD_HEIGHT)};
+                SDL_RenderFillRect(m_renderer, &hudBg);
 
-                SDL_FRect renderBounds = o->getBounds();
-                renderBounds.x -= cameraOffsetX;
-
-                // render opponent texture
-                auto opponentTexture = TextureManager::getInstance().getTexture(o->getTextureKey(), m_renderer);
-                if (opponentTexture) {
-                    SDL_RenderTexture(m_renderer, opponentTexture.get(), nullptr, &renderBounds);
-                } else {
-                    // fallback rect
-                    SDL_SetRenderDrawColor(m_renderer, 255, 0, 255, 255);
-                    SDL_RenderFillRect(m_renderer, &renderBounds);
-                }
-
-                //render opponent projectiles
-                const auto& op = o->getProjectiles();
-                for (const auto& p : op) { 
-                    if (p.getAge() >= p.getLifetime()) continue;
-
-                    // full intended endpoint
-                    float dx = p.getCurrentX() - p.getSpawnX();
-                    float dy = p.getCurrentY() - p.getSpawnY();
-                    float intendedEndX = p.getSpawnX() + dx * 4.0f;
-                    float intendedEndY = p.getSpawnY() + dy * 4.0f;
-
-                    // clip to landscape
-                    SDL_FPoint clipped = clipRayToLandscape(p.getSpawnX(), p.getSpawnY(), intendedEndX, intendedEndY, state.landscape);
-
-                    // camera offset
-                    SDL_FPoint start = { p.getSpawnX() - cameraOffsetX, p.getSpawnY() };
-                    SDL_FPoint end   = { clipped.x - cameraOffsetX, clipped.y };
-
-                    SDL_Color color = p.getColor();
-                    SDL_SetRenderDrawColor(m_renderer, color.r, color.g, color.b, color.a);
-                    SDL_RenderLine(m_renderer, start.x, start.y, end.x, end.y);
-                }
+                // HUD separator line
+                SDL_SetRenderDrawColor(m_renderer, 200, 200, 200, 255);
+                SDL_RenderLine(m_renderer, 0.0f, static_cast<float>(Config::Game::HUD_HEIGHT), static_cast<float>(m_windowWidth), static_cast<float>(Config::Game::HUD_HEIGHT));
             }
 
-            // render particles
-            for (const auto& particle : state.particles) {
-                if (particle.isAlive()) { 
-                    SDL_FRect renderBounds = { particle.getX(), particle.getY(), particle.getCurrentSize(), particle.getCurrentSize() };
-                    renderBounds.x -= cameraOffsetX; // apply camera offset
-
-                    SDL_SetRenderDrawColor(m_renderer, particle.getR(), particle.getG(), particle.getB(), particle.getAlpha());
-                    SDL_RenderFillRect(m_renderer, &renderBounds);
-                }
+            {
+                PROFILE_SCOPE(ProfileSection::RENDER_WORLD);
+                renderEntities(snapshot);
             }
 
-            // render landscape
-            if (!state.landscape.empty()) {
-                SDL_SetRenderDrawColor(m_renderer, 100, 80, 60, 255);
-                for (size_t i = 0; i < state.landscape.size() - 1; ++i) {
-                    SDL_FPoint p1 = { state.landscape[i].x - cameraOffsetX, state.landscape[i].y };
-                    SDL_FPoint p2 = { state.landscape[i + 1].x - cameraOffsetX, state.landscape[i + 1].y };
-                    SDL_RenderLine(m_renderer, p1.x, p1.y, p2.x, p2.y);
-                }
+            {
+                PROFILE_SCOPE(ProfileSection::RENDER_PARTICLES);
+                renderParticles(snapshot);
             }
 
-            // render health items
-            for (const auto& item : state.healthItems) {
-                if (!item || !item->isAlive()) continue;
-
-                SDL_FRect renderBounds = item->getBounds();
-                renderBounds.x -= cameraOffsetX;
-
-                auto itemTexture = TextureManager::getInstance().getTexture(item->getTextureKey(), m_renderer);
-                if (itemTexture) {
-                    // handle blinking
-                    Uint8 originalAlpha = 255;
-                    if (item->isBlinking()) {
-                         originalAlpha = static_cast<Uint8>(item->getBlinkAlpha());
-                    }
-                    SDL_SetTextureAlphaMod(itemTexture.get(), originalAlpha);
-                    SDL_RenderTexture(m_renderer, itemTexture.get(), nullptr, &renderBounds);
-                    SDL_SetTextureAlphaMod(itemTexture.get(), 255); // ...resets alpha for next item
-                } else {
-                    // fallback rectangle
-                    SDL_SetRenderDrawColor(m_renderer, 0, 255, 0, 255);
-                    if (item->getType() == HealthItemType::WORLD) {
-                        SDL_SetRenderDrawColor(m_renderer, 255, 255, 0, 255);
-                    }
-                    if (item->isBlinking()) {
-                        // blinking effect
-                        if (static_cast<int>(SDL_GetTicks() / (static_cast<int>(HealthItem::BLINK_DURATION * 1000) / 2)) % 2 == 0) {
-                             SDL_RenderFillRect(m_renderer, &renderBounds);
-                        }
-                    } else {
-                         SDL_RenderFillRect(m_renderer, &renderBounds);
-                    }
-                }
+            {
+                PROFILE_SCOPE(ProfileSection::RENDER_LANDSCAPE);
+                renderLandscape(snapshot);
             }
 
-            renderMinimap(state);
-            renderHealthBars(state);
-            renderScore(state);
+            {
+                PROFILE_SCOPE(ProfileSection::RENDER_MINIMAP);
+                renderMinimap(snapshot);
+            }
+            {
+                PROFILE_SCOPE(ProfileSection::RENDER_HUD);
+                renderHealthBars(snapshot);
+                renderScore(snapshot);
+            }
         }
             break;
         case GameStateData::State::GAME_OVER:
-            if (state.waitingForHighScore) {
-                renderHighScoreEntryScreen(state);
+            if (snapshot.waitingForHighScore) {
+                renderHighScoreEntryScreen(snapshot);
             } else {
-                renderGameOverScreen(state);
+                renderGameOverScreen(snapshot);
             }
             break;
     }
-    SDL_RenderPresent(m_renderer);
+
+    {
+        PROFILE_SCOPE(ProfileSection::RENDER_TEXT);
+        m_textRenderer.flush(m_renderer); // all text for the frame, one draw per atlas page
+    }
+
+    // the overlay covers the game's text, so its own text is a second batch on top
+    if (m_showProfiler) {
+        renderProfilerOverlay();
+        m_textRenderer.flush(m_renderer);
+    }
+}
+
+// world
+void Platform::renderEntities(const RenderSnapshot& snapshot) {
+    if (snapshot.hasPlayer) {
+        m_spriteBatch.draw(SpriteId::PLAYER, toScreen(snapshot.player), snapshot.playerFacingLeft); // flipped to face left
+    }
+
+    for (const RenderSnapshot::OpponentLayer& layer : snapshot.opponents) {
+        for (const RenderSnapshot::Sprite& sprite : layer.sprites) {
+            m_spriteBatch.draw(layer.spriteId, toScreen(sprite));
+        }
+    }
+    renderHealthItems(snapshot);
+    // every sprite in the world in one draw, under the beams, particles and landscape
+    m_spriteBatch.flush(m_renderer);
+
+    // player beams and opponent shots, already clipped against the landscape
+    for (const RenderSnapshot::Line& line : snapshot.projectiles) {
+        SDL_SetRenderDrawColor(m_renderer, line.color.r, line.color.g, line.color.b, line.color.a);
+        float endX = lerp(line.previousEnd.x, line.end.x, m_alpha);
+        float endY = lerp(line.previousEnd.y, line.end.y, m_alpha);
+        SDL_RenderLine(m_renderer, line.start.x - m_viewX, line.start.y, endX - m_viewX, endY);
+    }
+}
+
+void Platform::renderParticles(const RenderSnapshot& snapshot) {
+    float cameraOffsetX = m_viewX;
+
+    // render particles: one colored quad each, all submitted in a single geometry call
+    for (const RenderSnapshot::ParticleQuad& particle : snapshot.particles) {
+        SDL_FRect renderBounds = particle.bounds;
+        renderBounds.x -= cameraOffsetX; // apply camera offset
+        m_particleBatch.addRect(renderBounds, particle.color);
+    }
+    m_particleBatch.flush(m_renderer, nullptr);
+}
+
+void Platform::renderLandscape(const RenderSnapshot& snapshot) {
+    float cameraOffsetX = m_viewX;
+
+    // render landscape (only the vertices on screen)
+    m_landscapePoints.assign(snapshot.landscape.begin(), snapshot.landscape.end());
+    if (m_landscapePoints.size() > 1) {
+        for (SDL_FPoint& p : m_landscapePoints) p.x -= cameraOffsetX;
+        SDL_SetRenderDrawColor(m_renderer, 100, 80, 60, 255);
+        SDL_RenderLines(m_renderer, m_landscapePoints.data(), static_cast<int>(m_landscapePoints.size()));
+    }
+}
+
+void Platform::renderHealthItems(const RenderSnapshot& snapshot) {
+    for (const RenderSnapshot::HealthItemSprite& item : snapshot.healthItems) {
+        m_spriteBatch.draw(item.spriteId, toScreen(item.sprite), false, item.alpha); // fades while blinking
+    }
 }
 
+// END: world
+
 // input
-GameInput Platform::pollInput(const GameStateData& state) {
-    GameInput input{};
+void Platform::pollInput() {
+    m_inputEvents.clear();
     SDL_Event event;
 
-    // always poll quit/escape/enter/mouse
+    // every event is queued with its own timestamp; the simulation thread sorts them into ticks
     while (SDL_PollEvent(&event)) {
+        InputEvent input;
+        input.timestampNs = event.common.timestamp;
         if (event.type == SDL_EVENT_QUIT) {
-            input.quit = true;
+            input.type = InputEvent::Type::QUIT;
         } else if (event.type == SDL_EVENT_KEY_DOWN) {
-            if (event.key.key == SDLK_ESCAPE) input.escape = true;
-            else if (event.key.key == SDLK_RETURN) input.enter = true;
-        } else if (event.type == SDL_EVENT_MOUSE_BUTTON_DOWN) {
-            if (event.button.button == SDL_BUTTON_LEFT) {
-                input.mouseClick = true;
-                input.mouseX = event.button.x;
-                input.mouseY = event.button.y;
+            if (event.key.key == SDLK_F3) {
+                if (!event.key.repeat) m_showProfiler = !m_showProfiler;
+                continue;
             }
-        } else if (event.type == SDL_EVENT_TEXT_INPUT) { // for text input
-            if (event.text.text[0] != '\0' && event.text.text[1] == '\0') { // ensure it's a single character
-                char c = event.text.text[0];
-                if ((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9')) {
-                    input.charInputEvent = true;
-                    input.inputChar = c;
-                }
+            if (event.key.key == SDLK_ESCAPE) {
+                input.type = InputEvent::Type::ESCAPE;
+            } else if (event.key.key == SDLK_RETURN) {
+                input.type = InputEvent::Type::ENTER;
+            } else {
+                if (event.key.repeat) continue; // held keys only care about the first press
+                input.type = InputEvent::Type::KEY_DOWN;
+                input.scancode = event.key.scancode;
             }
+        } else if (event.type == SDL_EVENT_KEY_UP) {
+            input.type = InputEvent::Type::KEY_UP;
+            input.scancode = event.key.scancode;
+        } else if (event.type == SDL_EVENT_MOUSE_BUTTON_DOWN) {
+            if (event.button.button != SDL_BUTTON_LEFT) continue;
+            input.type = InputEvent::Type::MOUSE_CLICK;
+            input.mouseX = static_cast<int>(event.button.x);
+            input.mouseY = static_cast<int>(event.button.y);
+        } else if (event.type == SDL_EVENT_TEXT_INPUT) { // for text input
+            if (event.text.text[0] == '\0' || event.text.text[1] != '\0') continue; // ensure it's a single character
+            char c = event.text.text[0];
+            if (!((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9'))) continue;
+            input.type = InputEvent::Type::CHAR;
+            input.inputChar = c;
+        } else {
+            continue;
         }
+        m_inputEvents.push_back(input);
     }
 
-    // only poll movement/shoot/boost if playing
-    if (state.state == GameStateData::State::PLAYING) {
-        const bool* keys = SDL_GetKeyboardState(nullptr);
-        input.moveLeft  = keys[SDL_SCANCODE_LEFT] || keys[SDL_SCANCODE_A];
-        input.moveRight = keys[SDL_SCANCODE_RIGHT] || keys[SDL_SCANCODE_D];
-        input.moveUp    = keys[SDL_SCANCODE_UP] || keys[SDL_SCANCODE_W];
-        input.moveDown  = keys[SDL_SCANCODE_DOWN] || keys[SDL_SCANCODE_S];
-        input.shoot     = keys[SDL_SCANCODE_SPACE];
-        input.boost     = keys[SDL_SCANCODE_C] || keys[SDL_SCANCODE_LSHIFT] || keys[SDL_SCANCODE_RSHIFT];
-    }
-    else if (state.state == GameStateData::State::GAME_OVER && state.waitingForHighScore) {
-        const bool* keys = SDL_GetKeyboardState(nullptr);
-        // poll for backspace/delete specifically on the high score screen
-        if (keys[SDL_SCANCODE_BACKSPACE] || keys[SDL_SCANCODE_DELETE]) {
-             input.backspacePressed = true;
-        }
-    }
-
-    return input;
+    // held keys are masked by the simulation thread for states that ignore them
+    m_inputQueue.push(m_inputEvents);
 }
 
-void Platform::updateTextInputState(const GameStateData& state) {
-    bool shouldTextInputBeActive = (state.state == GameStateData::State::GAME_OVER && state.waitingForHighScore);
+void Platform::updateTextInputState(const RenderSnapshot& snapshot) {
+    bool shouldTextInputBeActive = (snapshot.state == GameStateData::State::GAME_OVER && snapshot.waitingForHighScore);
 
     if (shouldTextInputBeActive && !m_textInputActive) {
         // start text input
@@ -457,29 +568,17 @@ void Platform::renderHowToPlayScreen() {
     y_pos += line_spacing;
 
     // bombs
-    auto basicTexture = TextureManager::getInstance().getTexture(Config::Textures::BASIC_OPPONENT, m_renderer);
-    if (basicTexture) {
-        SDL_FRect imageRect = { (float)(m_windowWidth/2 - 430), (float)y_pos, (float)opponent_image_size, (float)opponent_image_size };
-        SDL_RenderTexture(m_renderer, basicTexture.get(), nullptr, &imageRect);
-    }
+    m_spriteBatch.draw(SpriteId::BASIC_OPPONENT, { (float)(m_windowWidth/2 - 430), (float)y_pos, (float)opponent_image_size, (float)opponent_image_size });
     renderText("Bombs: Do not shoot at you, but damage the world if they reach the bottom - worth 300 points.", m_windowWidth/2 - 390, y_pos, white, FontSize::SMALL);
     y_pos += line_spacing + 5;
 
     // aggressive
-    auto aggressiveTexture = TextureManager::getInstance().getTexture(Config::Textures::AGGRESSIVE_OPPONENT, m_renderer);
-    if (aggressiveTexture) {
-        SDL_FRect imageRect = { (float)(m_windowWidth/2 - 430), (float)y_pos, (float)opponent_image_size, (float)opponent_image_size };
-        SDL_RenderTexture(m_renderer, aggressiveTexture.get(), nullptr, &imageRect);
-    }
+    m_spriteBatch.draw(SpriteId::AGGRESSIVE_OPPONENT, { (float)(m_windowWidth/2 - 430), (float)y_pos, (float)opponent_image_size, (float)opponent_image_size });
     renderText("Aggressive: Chases the player, fires aimed shots - worth 100 points.", m_windowWidth/2 - 390, y_pos, white, FontSize::SMALL);
     y_pos += line_spacing + 5; 
 
     // sniper
-    auto sniperTexture = TextureManager::getInstance().getTexture(Config::Textures::SNIPER_OPPONENT, m_renderer);
-    if (sniperTexture) {
-        SDL_FRect imageRect = { (float)(m_windowWidth/2 - 430), (float)y_pos, (float)opponent_image_size, (float)opponent_image_size };
-        SDL_RenderTexture(m_renderer, sniperTexture.get(), nullptr, &imageRect);
-    }
+    m_spriteBatch.draw(SpriteId::SNIPER_OPPONENT, { (float)(m_windowWidth/2 - 430), (float)y_pos, (float)opponent_image_size, (float)opponent_image_size });
     renderText("Sniper: Moves slowly, fires faster with more accuracy - worth 100 points.", m_windowWidth/2 - 390, y_pos, white, FontSize::SMALL);
     y_pos += line_spacing + 30; 
 
@@ -487,10 +586,11 @@ void Platform::renderHowToPlayScreen() {
     y_pos += line_spacing + 20;
     renderText("Press ESC or ENTER to return to the menu.", m_windowWidth/2 - 150, y_pos, white, FontSize::SMALL);
 
+    m_spriteBatch.flush(m_renderer);
     renderCloseButton();
 }
 
-void Platform::renderGameOverScreen(const GameStateData& state) {
+void Platform::renderGameOverScreen(const RenderSnapshot& snapshot) {
     SDL_Color white = {255, 255, 255, 255};
     SDL_Color red = {255, 0, 0, 255};
 
@@ -498,29 +598,35 @@ void Platform::renderGameOverScreen(const GameStateData& state) {
     SDL_RenderClear(m_renderer);
     
     renderText("GAME OVER", m_windowWidth / 2 - 100, m_windowHeight / 2 - 60, red, FontSize::LARGE);
-    renderText(("Score: " + std::to_string(state.playerScore)).c_str(), m_windowWidth / 2 - 60, m_windowHeight / 2, white, FontSize::MEDIUM);
+    int scoreX = m_windowWidth / 2 - 60;
+    scoreX += renderText("Score: ", scoreX, m_windowHeight / 2, white, FontSize::MEDIUM);
+    renderNumber(snapshot.playerScore, scoreX, m_windowHeight / 2, white, FontSize::MEDIUM);
 
     renderCloseButton();
 }
 
-void Platform::renderHighScoreEntryScreen(const GameStateData& state) {
+void Platform::renderHighScoreEntryScreen(const RenderSnapshot& snapshot) {
     SDL_Color white = {255, 255, 255, 255};
     SDL_Color yellow = {255, 255, 0, 255};
 
     SDL_SetRenderDrawColor(m_renderer, 0, 0, 0, 255);
     SDL_RenderClear(m_renderer);
     renderText("NEW HIGH SCORE!", m_windowWidth / 2 - 120, m_windowHeight / 2 - 100, yellow, FontSize::LARGE);
-    renderText(("Position: #" + std::to_string(state.highScoreIndex + 1)).c_str(), m_windowWidth / 2 - 80, m_windowHeight / 2 - 50, white, FontSize::MEDIUM);
-    renderText(("Score: " + std::to_string(state.playerScore)).c_str(), m_windowWidth / 2 - 60, m_windowHeight / 2 - 20, white, FontSize::MEDIUM);
+    int positionX = m_windowWidth / 2 - 80;
+    positionX += renderText("Position: #", positionX, m_windowHeight / 2 - 50, white, FontSize::MEDIUM);
+    renderNumber(snapshot.highScoreIndex + 1, positionX, m_windowHeight / 2 - 50, white, FontSize::MEDIUM);
+    int scoreX = m_windowWidth / 2 - 60;
+    scoreX += renderText("Score: ", scoreX, m_windowHeight / 2 - 20, white, FontSize::MEDIUM);
+    renderNumber(snapshot.playerScore, scoreX, m_windowHeight / 2 - 20, white, FontSize::MEDIUM);
     renderText("Enter Name (max 10 chars):", m_windowWidth / 2 - 140, m_windowHeight / 2 + 20, white, FontSize::SMALL);
-    renderText((state.highScoreNameInput + "_").c_str(), m_windowWidth / 2 - 40, m_windowHeight / 2 + 50, white, FontSize::MEDIUM);
+    renderText((snapshot.highScoreNameInput + "_").c_str(), m_windowWidth / 2 - 40, m_windowHeight / 2 + 50, white, FontSize::MEDIUM);
 
     renderCloseButton();
 }
 // END: screens and menus
 
 // HUD (top-bar)
-void Platform::renderHealthBars(const GameStateData& state) {
+void Platform::renderHealthBars(const RenderSnapshot& snapshot) {
     const int barW = 200;
     const int barH = 10;
     const int barX = 2;
@@ -528,13 +634,13 @@ void Platform::renderHealthBars(const GameStateData& state) {
     const int spacing = 5;
     
     SDL_Color white = {255, 255, 255, 255};
-    float pHealth = (float)state.player->getHealth();
-    float pMaxHealth = (float)state.player->getMaxHealth();
+    float pHealth = (float)snapshot.playerHealth;
+    float pMaxHealth = (float)snapshot.playerMaxHealth;
     float playerHealthRatio = pHealth / pMaxHealth;
     
     renderHealthBar("Player Health:", barX, barY, barW, barH, playerHealthRatio, white);
     
-    float worldHealthRatio = (float)state.worldHealth / 10.0f;
+    float worldHealthRatio = (float)snapshot.worldHealth / 10.0f;
     int worldBarY = barY + 20 + barH + spacing;
     renderHealthBar("World Health:", barX, worldBarY, barW, barH, worldHealthRatio, white);    
 }
@@ -556,10 +662,10 @@ void Platform::renderHealthBar(const char* label, int x, int y, int width, int h
     SDL_RenderRect(m_renderer, &bgRect);
 }
 
-void Platform::renderMinimap(const GameStateData& state) {
-    const int mmW = 210;
+void Platform::renderMinimap(const RenderSnapshot& snapshot) {
+    const int mmW = RenderSnapshot::MINIMAP_WIDTH;
     const int mmH = 42;
-    const int mmX = (state.screenWidth - mmW)/2;
+    const int mmX = (snapshot.screenWidth - mmW)/2;
     const int mmY = 20;
     SDL_SetRenderDrawColor(m_renderer, 0, 40, 80, 200);
     SDL_FRect mm = {(float)mmX, (float)mmY, (float)mmW, (float)mmH};
@@ -567,12 +673,12 @@ void Platform::renderMinimap(const GameStateData& state) {
     SDL_SetRenderDrawColor(m_renderer, 0, 100, 200, 255);
     SDL_RenderRect(m_renderer, &mm);
 
-    float sx = (float)mmW / state.worldWidth;
-    float sy = (float)mmH / state.worldHeight;
+    float sx = (float)mmW / snapshot.worldWidth;
+    float sy = (float)mmH / snapshot.worldHeight;
 
     // goldish dot for player
-    if (state.player) {
-        SDL_FRect pb = state.player->getBounds();
+    if (snapshot.hasPlayer) {
+        SDL_FRect pb = snapshot.player.bounds;
         float px = (pb.x * sx + mmX) - 1.0f;
         float py = pb.y * sy + mmY;
         SDL_SetRenderDrawColor(m_renderer, 223, 245, 39, 200);
@@ -581,103 +687,80 @@ void Platform::renderMinimap(const GameStateData& state) {
     }
 
     // red dots for opponents
-    for (const auto& o : state.opponents) {
-        if (o && o->isAlive()) {
-            SDL_FRect ob = o->getBounds();
+    SDL_SetRenderDrawColor(m_renderer, 255, 0, 0, 255);
+    for (const RenderSnapshot::OpponentLayer& layer : snapshot.opponents) {
+        for (const RenderSnapshot::Sprite& sprite : layer.sprites) {
+            const SDL_FRect& ob = sprite.bounds;
             float ox = (ob.x * sx + mmX) - 1.0f;
             float oy = ob.y * sy + mmY;
-            SDL_SetRenderDrawColor(m_renderer, 255, 0, 0, 255);
             SDL_FRect od = {ox, oy, 3, 3};
             SDL_RenderFillRect(m_renderer, &od);
         }
     }
 
     // green dots for health
-    for (const auto& h : state.healthItems) {
-        if (h && h->isAlive()) {
-            SDL_FRect hb = h->getBounds();
-            float hx = (hb.x * sx + mmX) - 1.0f;
-            float hy = hb.y * sy + mmY;
-            SDL_SetRenderDrawColor(m_renderer, 0, 255, 0, 255);
-            SDL_FRect hd = {hx, hy, 3, 3};
-            SDL_RenderFillRect(m_renderer, &hd);
-        }
+    SDL_SetRenderDrawColor(m_renderer, 0, 255, 0, 255);
+    for (const RenderSnapshot::HealthItemSprite& h : snapshot.healthItems) {
+        float hx = (h.sprite.bounds.x * sx + mmX) - 1.0f;
+        float hy = h.sprite.bounds.y * sy + mmY;
+        SDL_FRect hd = {hx, hy, 3, 3};
+        SDL_RenderFillRect(m_renderer, &hd);
     }
 
-    // render landscape
-    if (!state.landscape.empty()) {
-        SDL_SetRenderDrawColor(m_renderer, 180, 150, 100, 200);
-        float sx = (float)mmW / state.worldWidth;
-        float sy = (float)mmH / state.worldHeight;
-        for (size_t i = 0; i < state.landscape.size() - 1; ++i) {
-            float x1 = state.landscape[i].x * sx + mmX;
-            float y1 = state.landscape[i].y * sy + mmY;
-            float x2 = state.landscape[i + 1].x * sx + mmX;
-            float y2 = state.landscape[i + 1].y * sy + mmY;
-            SDL_RenderLine(m_renderer, x1, y1, x2, y2);
+    // render landscape, sampled once per minimap pixel however wide the world is
+    if (!snapshot.minimapGround.empty()) {
+        m_landscapePoints.resize(mmW + 1);
+        for (int i = 0; i <= mmW; ++i) {
+            m_landscapePoints[i] = { i + (float)mmX, snapshot.minimapGround[i] * sy + mmY };
         }
+        SDL_SetRenderDrawColor(m_renderer, 180, 150, 100, 200);
+        SDL_RenderLines(m_renderer, m_landscapePoints.data(), static_cast<int>(m_landscapePoints.size()));
     }
 
-    float vx = state.cameraX * sx + mmX;
-    float vw = state.screenWidth * sx;
+    float vx = m_viewX * sx + mmX;
+    float vw = snapshot.screenWidth * sx;
     SDL_SetRenderDrawColor(m_renderer, 255, 255, 255, 100);
     SDL_FRect vr = {vx, (float)mmY, vw, (float)mmH};
     SDL_RenderRect(m_renderer, &vr);
 }
 
-void Platform::renderScore(const GameStateData& state) {
+void Platform::renderScore(const RenderSnapshot& snapshot) {
     const int barY = 10;    
     SDL_Color white = {255, 255, 255, 255};
     float rightOffset = m_windowWidth - 150;
     
     renderText("Score:", rightOffset, barY, white, FontSize::SMALL);
-    std::string scoreStr = std::to_string(state.playerScore);
-    renderText(scoreStr.c_str(), m_windowWidth - 90, barY, white, FontSize::SMALL);
+    renderNumber(snapshot.playerScore, m_windowWidth - 90, barY, white, FontSize::SMALL);
 }
 // END: HUD (top-bar)
 
 // helpers
-void Platform::renderText(const char* text, int x, int y, const SDL_Color& color, FontSize sizeEnum) {
-    int fontSize{16}; 
-    switch (sizeEnum) {
-        case FontSize::SMALL:
-            fontSize = 16;
-            break;
-        case FontSize::MEDIUM: 
-            fontSize = 24;
-            break;        
-        case FontSize::LARGE:
-            fontSize = 36;
-            break;        
-        case FontSize::GRANDELOCO:
-            fontSize = 52;
-            break;        
-    }
-
-    auto font = FontManager::getInstance().getFont(Config::Fonts::DEFAULT_FONT_FILE, fontSize);
-    if (!font) {
-        SDL_Log("Failed to get font from manager");
-        return; 
-    }
-
-    SDL_Surface* fontSurface = TTF_RenderText_Solid(font.get(), text, strlen(text), color);
-    if (!fontSurface) {
-        SDL_Log("Text Render failed: %s", SDL_GetError());
-        return;
-    }
+int Platform::getFrameCap() const {
+    if (m_timing.frameCap > 0) return m_timing.frameCap;
+    if (m_vsync) return 0;
+
+    // without VSync the loop would otherwise render as fast as it can
+    const SDL_DisplayMode* mode = SDL_GetCurrentDisplayMode(SDL_GetDisplayForWindow(m_window));
+    if (mode && mode->refresh_rate > 0.0f) return static_cast<int>(mode->refresh_rate + 0.5f);
+    return Config::Timing::FALLBACK_FRAME_CAP;
+}
 
-    SDL_Texture* fontTexture = SDL_CreateTextureFromSurface(m_renderer, fontSurface);
-    if (!fontTexture) {
-        SDL_DestroySurface(fontSurface);
-        SDL_Log("Failed to create texture from font surface: %s", SDL_GetError());
-        return;
-    }
+SDL_FRect Platform::toScreen(const RenderSnapshot::Sprite& sprite) const {
+    SDL_FRect r = sprite.bounds;
+    r.x = lerp(sprite.previous.x, sprite.bounds.x, m_alpha) - m_viewX;
+    r.y = lerp(sprite.previous.y, sprite.bounds.y, m_alpha);
+    return r;
+}
 
-    SDL_FRect dst = { (float)x, (float)y, (float)fontSurface->w, (float)fontSurface->h };
-    SDL_RenderTexture(m_renderer, fontTexture, nullptr, &dst);
+int Platform::renderText(const char* text, int x, int y, const SDL_Color& color, FontSize sizeEnum) {
+    // queued into the glyph atlas batch; drawn when the frame is flushed
+    return static_cast<int>(m_textRenderer.drawText(text, (float)x, (float)y, color, sizeEnum));
+}
 
-    SDL_DestroyTexture(fontTexture);
-    SDL_DestroySurface(fontSurface);
+int Platform::renderNumber(int value, int x, int y, const SDL_Color& color, FontSize sizeEnum) {
+    char digits[16];
+    SDL_snprintf(digits, sizeof(digits), "%d", value);
+    return renderText(digits, x, y, color, sizeEnum);
 }
 
 void Platform::renderMenuButton(int x, int y, int width, int height, SDL_Color& textColor, const std::string& text) {
@@ -720,121 +803,38 @@ void Platform::renderCloseButton() {
     renderText("X", textX, textY, white, closeButtonFontSize);
 }
 
-// for player beams
-float Platform::findBeamLandscapeIntersection(float startX, float beamY, bool goingRight, const std::vector<SDL_FPoint>& landscape, float worldWidth) {
-    if (landscape.empty()) return goingRight ? worldWidth : 0.0f;
-
-    // clamp beamY
-    if (beamY <= 0) return goingRight ? worldWidth : 0.0f;
-
-    // determine search range
-    size_t startIdx = 0;
-    size_t endIdx = landscape.size() - 1;
-
-    if (goingRight) {
-        // find first segment where x >= startX
-        for (size_t i = 0; i < landscape.size() - 1; ++i) {
-            float x0 = landscape[i].x;
-            float x1 = landscape[i + 1].x;
-            if (x1 < startX) continue;
-
-            // this segment or next may contain intersection
-            float y0 = landscape[i].y;
-            float y1 = landscape[i + 1].y;
-
-            // if beam is above both points, beam continues
-            if (beamY < y0 && beamY < y1) {
-                // no intersection in this segment
-                continue;
-            }
-
-            // if beam is below both, it is already on ground - shouldn't happen if projectile was alive
-            if (beamY >= y0 && beamY >= y1)                 
-                return std::max(startX, x0);// beam hits ground at segment start
-            
-            // otherwise... interpolate intersection
-            // find X where the horizontal beam crosses the straight line segment between (x0,y0) and (x1,y1) 
-            // ground line: y = y0 + t*(y1 - y0), x = x0 + t*(x1 - x0)
-            float t = (beamY - y0) / (y1 - y0);
-            if (t >= 0.0f && t <= 1.0f) {
-                float intersectX = x0 + t * (x1 - x0);
-                if (intersectX >= startX) {
-                    return intersectX;
-                }
-            }
-        }
-        // if no intersection found, the beam goes to world edge
-        return worldWidth;
-    } else {
-        // going left: search backward
-        for (size_t i = landscape.size() - 1; i > 0; --i) {
-            float x0 = landscape[i - 1].x;
-            float x1 = landscape[i].x;
-            if (x0 > startX) continue;
-
-            float y0 = landscape[i - 1].y;
-            float y1 = landscape[i].y;
-
-            if (beamY < y0 && beamY < y1) {
-                continue;
-            }
-            if (beamY >= y0 && beamY >= y1) {
-                return std::min(startX, x1);
-            }
-
-            float t = (beamY - y0) / (y1 - y0);
-            if (t >= 0.0f && t <= 1.0f) {
-                float intersectX = x0 + t * (x1 - x0);
-                if (intersectX <= startX) {
-                    return intersectX;
-                }
-            }
+void Platform::renderProfilerOverlay() {
+    const Profiler& profiler = Profiler::getInstance();
+    const int x = 10;
+    const int y = Config::Game::HUD_HEIGHT + 10;
+    const int lineHeight = 18;
+    const int columns[3] = { x + 150, x + 215, x + 280 };
+    SDL_Color white = {255, 255, 255, 255};
+    SDL_Color grey = {170, 170, 170, 255};
+
+    SDL_SetRenderDrawColor(m_renderer, 0, 0, 0, 200);
+    SDL_FRect bg = { (float)x - 6, (float)y - 4, 345.0f, (float)lineHeight * (Profiler::SECTION_COUNT + 1) + 8 };
+    SDL_RenderFillRect(m_renderer, &bg);
+
+    renderText("ms", x, y, grey, FontSize::SMALL);
+    renderText("min", columns[0], y, grey, FontSize::SMALL);
+    renderText("avg", columns[1], y, grey, FontSize::SMALL);
+    renderText("p99", columns[2], y, grey, FontSize::SMALL);
+
+    char value[16];
+    for (int i = 0; i < Profiler::SECTION_COUNT; ++i) {
+        ProfileSection section = static_cast<ProfileSection>(i);
+        bool topLevel = section == ProfileSection::FRAME || section == ProfileSection::GAME_UPDATE || section == ProfileSection::RENDER || section == ProfileSection::AUDIO;
+        int lineY = y + lineHeight * (i + 1);
+        renderText(Profiler::getName(section), topLevel ? x : x + 16, lineY, topLevel ? white : grey, FontSize::SMALL);
+
+        Profiler::Stats stats = profiler.getStats(section);
+        const float values[3] = { stats.minMs, stats.avgMs, stats.p99Ms };
+        for (int c = 0; c < 3; ++c) {
+            SDL_snprintf(value, sizeof(value), "%.2f", values[c]);
+            renderText(value, columns[c], lineY, white, FontSize::SMALL);
         }
-        return 0.0f;
     }
 }
 
-// for opponent projectiles
-SDL_FPoint Platform::clipRayToLandscape(float startX, float startY, float endX, float endY, const std::vector<SDL_FPoint>& landscape) const {
-    if (landscape.empty()) return {endX, endY};
-
-    // ray: from (startX, startY) to (endX, endY)
-    float rayDx = endX - startX;
-    float rayDy = endY - startY;
-    float bestT = 1.0f; // full length
-
-    // check intersection with each landscape segment
-    for (size_t i = 0; i < landscape.size() - 1; ++i) {
-        float x0 = landscape[i].x;
-        float y0 = landscape[i].y;
-        float x1 = landscape[i + 1].x;
-        float y1 = landscape[i + 1].y;
-
-        // landscape segment vector
-        float segDx = x1 - x0;
-        float segDy = y1 - y0;
-
-        // solve: 
-        //      startX + t1*rayDx = x0 + t2*segDx
-        //      startY + t1*rayDy = y0 + t2*segDy
-        float denom = rayDx * segDy - rayDy * segDx;
-        if (std::abs(denom) < 1e-6f) continue; // parallel
-
-        float t2 = (rayDx * (startY - y0) - rayDy * (startX - x0)) / denom;
-        if (t2 < 0.0f || t2 > 1.0f) continue; // intersection not on segment
-
-        float t1 = (x0 + t2 * segDx - startX) / rayDx;
-        if (std::abs(rayDx) < 1e-6f) t1 = (y0 + t2 * segDy - startY) / rayDy;
-
-        if (t1 >= 0.0f && t1 < bestT) {
-            bestT = t1;
-        }
-    }
-
-    // return clipped endpoint
-    return {
-        startX + bestT * rayDx,
-        startY + bestT * rayDy
-    };
-}
 // END: helpers
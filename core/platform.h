@@ -1,55 +1,128 @@
 #pragma once
 #include <SDL3/SDL.h>
 #include <SDL3_ttf/SDL_ttf.h>
+#include <atomic>
 #include <memory>
 #include <string>
+#include <vector>
 #include "game.h"
+#include "render_snapshot.h"
+#include "triple_buffer.h"
+#include "frame_pacer.h"
+#include "input_queue.h"
 #include "texture_manager.h"
 #include "font_manager.h"
 #include "sound_manager.h"
+#include "text_renderer.h"
+#include "geometry_batch.h"
+#include "sprite_batch.h"
+#include "input_recording.h"
+#include "config.h"
+
+// tick rate and frame pacing, fixed for the whole session
+struct FrameTiming {
+    int tickRate = Config::Timing::TICK_RATE;
+    int maxCatchUpTicks = Config::Timing::MAX_CATCH_UP_TICKS;
+    int frameCap = Config::Timing::FRAME_CAP;
+    bool vsync = true;
+};
 
 class Platform {
 public:
     Platform();
     ~Platform();
 
+    void setFrameTiming(const FrameTiming& timing) { m_timing = timing; } // before initialize()
+    void setJobSystem(JobSystem* jobs) { m_jobs = jobs; } // before initialize(): assets are decoded on its workers
     bool initialize();
+    // the game ticks on its own thread; this (main) thread handles events and
+    // draws the latest snapshot the simulation published, so a slow present
+    // never holds up a tick
     void run(Game& sim);
     void shutdown();
 
+    // set before run(): a recorder captures every tick's input, a replay feeds
+    // recorded input to the game instead of the keyboard/mouse (quit still works)
+    void setInputRecorder(InputRecorder* recorder) { m_recorder = recorder; }
+    void setInputReplay(InputReplay* replay) { m_replay = replay; }
+    int getWindowWidth() const { return m_windowWidth; }
+    int getWindowHeight() const { return m_windowHeight; }
+
 private:
     SDL_Window* m_window = nullptr;
     SDL_Renderer* m_renderer = nullptr;
     int m_windowWidth = 800;
     int m_windowHeight = 600;
-    bool m_running = true;
+    std::atomic<bool> m_running{true};
     bool m_textInputActive = false; // track if text input is currently active
+    bool m_showProfiler = false; // F3
+
+    FrameTiming m_timing;
+    bool m_vsync = false; // requested and actually enabled
+    int getFrameCap() const; // 0 = uncapped
+
+    InputRecorder* m_recorder = nullptr;
+    InputReplay* m_replay = nullptr;
+    JobSystem* m_jobs = nullptr;
+
+    // everything is decoded behind a progress bar before initialize() returns
+    void preloadAssets();
+    void renderLoadingScreen(float progress);
+
+    // main thread -> simulation thread
+    std::atomic<int> m_simScreenWidth{800};
+    std::atomic<int> m_simScreenHeight{600};
+    InputQueue m_inputQueue;
+
+    // simulation thread -> main thread
+    TripleBuffer<RenderSnapshot> m_snapshots;
+    bool m_hasSnapshot = false;
+
+    void simulationLoop(Game& sim);
+    GameInput takeInput(const GameStateData& state, Uint64 tickDueNs);
 
     SDL_AudioDeviceID m_audioDeviceID = 0;
-    SDL_AudioSpec m_audioSpec;
+    SDL_AudioSpec m_audioSpec = {};
+
+    std::vector<SDL_FPoint> m_landscapePoints; // render scratch
+    TextRenderer m_textRenderer;
+    GeometryBatch m_particleBatch; // keeps its capacity, so steady-state frames don't allocate
+    SpriteBatch m_spriteBatch;     // player, opponents and health items, drawn together
 
-    void render(const GameStateData& state);
+    void render(const RenderSnapshot& snapshot);
+
+    // this frame's point between the snapshot's two ticks, set at the top of render()
+    float m_alpha = 1.0f;
+    float m_viewX = 0.0f; // interpolated camera
+    SDL_FRect toScreen(const RenderSnapshot::Sprite& sprite) const;
 
     // input
-    GameInput pollInput(const GameStateData& state);
-    void updateTextInputState(const GameStateData& state);
+    std::vector<InputEvent> m_inputEvents; // pollInput scratch
+    void pollInput();
+    void updateTextInputState(const RenderSnapshot& snapshot);
+
+    // world
+    void renderEntities(const RenderSnapshot& snapshot);
+    void renderParticles(const RenderSnapshot& snapshot);
+    void renderLandscape(const RenderSnapshot& snapshot);
+    void renderHealthItems(const RenderSnapshot& snapshot);
 
     // menus and screens
     void renderMainMenu();
     void renderHowToPlayScreen();
-    void renderGameOverScreen(const GameStateData& state);
-    void renderHighScoreEntryScreen(const GameStateData& state);
+    void renderGameOverScreen(const RenderSnapshot& snapshot);
+    void renderHighScoreEntryScreen(const RenderSnapshot& snapshot);
 
     // HUD (top bar)
-    void renderHealthBars(const GameStateData& state);
+    void renderHealthBars(const RenderSnapshot& snapshot);
     void renderHealthBar(const char* label, int x, int y, int width, int height, float healthRatio, const SDL_Color& labelColor = {255, 255, 255, 255});
-    void renderMinimap(const GameStateData& state);
-    void renderScore(const GameStateData& state);
+    void renderMinimap(const RenderSnapshot& snapshot);
+    void renderScore(const RenderSnapshot& snapshot);
 
     // helpers
-    void renderText(const char* text, int x, int y, const SDL_Color& color, FontSize size);
+    int renderText(const char* text, int x, int y, const SDL_Color& color, FontSize size); // returns the width drawn
+    int renderNumber(int value, int x, int y, const SDL_Color& color, FontSize size);
     void renderMenuButton(int x, int y, int width, int height, SDL_Color& textColor, const std::string& text);
     void renderCloseButton();
-    float findBeamLandscapeIntersection(float startX, float beamY, bool goingRight, const std::vector<SDL_FPoint>& landscape, float worldWidth); // for player beams (horizontal)
-    SDL_FPoint clipRayToLandscape(float startX, float startY, float endX, float endY, const std::vector<SDL_FPoint>& landscape) const; // for opponent projectiles
+    void renderProfilerOverlay();
 };
\ No newline at end of file
@@ -0,0 +1,156 @@
+#include "profiler.h"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+namespace {
+    const char* SECTION_NAMES[Profiler::SECTION_COUNT] = {
+        "frame",
+        "update",
+        "player",
+        "projectiles",
+        "opponents",
+        "particles",
+        "health_items",
+        "collisions",
+        "spawning",
+        "render",
+        "world",
+        "particles",
+        "landscape",
+        "minimap",
+        "hud",
+        "text",
+        "audio"
+    };
+
+    // column names in exported traces, where game and render sub-phases need telling apart
+    const char* SECTION_KEYS[Profiler::SECTION_COUNT] = {
+        "frame",
+        "update",
+        "update.player",
+        "update.projectiles",
+        "update.opponents",
+        "update.particles",
+        "update.health_items",
+        "update.collisions",
+        "update.spawning",
+        "render",
+        "render.world",
+        "render.particles",
+        "render.landscape",
+        "render.minimap",
+        "render.hud",
+        "render.text",
+        "audio"
+    };
+
+    bool endsWith(const std::string& s, const std::string& suffix) {
+        return s.size() >= suffix.size() && s.compare(s.size() - suffix.size(), suffix.size(), suffix) == 0;
+    }
+}
+
+Profiler& Profiler::getInstance() {
+    static Profiler instance;
+    return instance;
+}
+
+Profiler::Profiler()
+    : m_msPerTick(1000.0 / static_cast<double>(SDL_GetPerformanceFrequency())) {
+    for (auto& ticks : m_current) ticks.store(0, std::memory_order_relaxed);
+}
+
+void Profiler::endFrame() {
+    // FRAME is the wall time between consecutive endFrame() calls
+    Uint64 now = SDL_GetPerformanceCounter();
+    if (m_lastFrameEnd != 0) add(ProfileSection::FRAME, now - m_lastFrameEnd);
+    m_lastFrameEnd = now;
+
+    for (int s = 0; s < SECTION_COUNT; ++s) {
+        Uint64 ticks = m_current[s].exchange(0, std::memory_order_relaxed);
+        float ms = static_cast<float>(ticks * m_msPerTick);
+        m_history[s][m_historyPos] = ms;
+        if (m_traceEnabled) m_trace.push_back(ms);
+    }
+    m_historyPos = (m_historyPos + 1) % WINDOW_FRAMES;
+    m_historyCount = std::min(m_historyCount + 1, WINDOW_FRAMES);
+}
+
+Profiler::Stats Profiler::getStats(ProfileSection section) const {
+    Stats stats;
+    if (m_historyCount == 0) return stats;
+
+    const float* samples = m_history[static_cast<int>(section)];
+    m_sortScratch.assign(samples, samples + m_historyCount);
+
+    float sum = 0.0f;
+    stats.minMs = m_sortScratch[0];
+    for (float ms : m_sortScratch) {
+        sum += ms;
+        stats.minMs = std::min(stats.minMs, ms);
+    }
+    stats.avgMs = sum / m_historyCount;
+
+    size_t p99 = static_cast<size_t>(std::ceil(0.99 * m_historyCount)) - 1;
+    std::nth_element(m_sortScratch.begin(), m_sortScratch.begin() + p99, m_sortScratch.end());
+    stats.p99Ms = m_sortScratch[p99];
+    return stats;
+}
+
+const char* Profiler::getName(ProfileSection section) {
+    return SECTION_NAMES[static_cast<int>(section)];
+}
+
+bool Profiler::writeTrace(const std::string& path) const {
+    return endsWith(path, ".json") ? writeJson(path) : writeCsv(path);
+}
+
+bool Profiler::writeCsv(const std::string& path) const {
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        SDL_Log("Profiler: Failed to open '%s' for writing", path.c_str());
+        return false;
+    }
+
+    // one row per frame, one column (ms) per section
+    file << "frame_index";
+    for (const char* key : SECTION_KEYS) file << ',' << key;
+    file << '\n';
+
+    size_t frames = m_trace.size() / SECTION_COUNT;
+    for (size_t f = 0; f < frames; ++f) {
+        file << f;
+        for (int s = 0; s < SECTION_COUNT; ++s) file << ',' << m_trace[f * SECTION_COUNT + s];
+        file << '\n';
+    }
+    SDL_Log("Profiler: Wrote %zu frames to '%s'", frames, path.c_str());
+    return true;
+}
+
+bool Profiler::writeJson(const std::string& path) const {
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        SDL_Log("Profiler: Failed to open '%s' for writing", path.c_str());
+        return false;
+    }
+
+    // summary over the last WINDOW_FRAMES frames, then the full per-frame trace
+    size_t frames = m_trace.size() / SECTION_COUNT;
+    file << "{\n  \"frames\": " << frames << ",\n  \"summary\": {";
+    for (int s = 0; s < SECTION_COUNT; ++s) {
+        Stats stats = getStats(static_cast<ProfileSection>(s));
+        file << (s ? "," : "") << "\n    \"" << SECTION_KEYS[s] << "\": { \"min_ms\": " << stats.minMs
+             << ", \"avg_ms\": " << stats.avgMs << ", \"p99_ms\": " << stats.p99Ms << " }";
+    }
+    file << "\n  },\n  \"sections\": [";
+    for (int s = 0; s < SECTION_COUNT; ++s) file << (s ? ", " : "") << '"' << SECTION_KEYS[s] << '"';
+    file << "],\n  \"trace_ms\": [";
+    for (size_t f = 0; f < frames; ++f) {
+        file << (f ? ",\n    [" : "\n    [");
+        for (int s = 0; s < SECTION_COUNT; ++s) file << (s ? ", " : "") << m_trace[f * SECTION_COUNT + s];
+        file << ']';
+    }
+    file << "\n  ]\n}\n";
+    SDL_Log("Profiler: Wrote %zu frames to '%s'", frames, path.c_str());
+    return true;
+}
@@ -0,0 +1,104 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <atomic>
+#include <string>
+#include <vector>
+
+// every timed phase. sub-phases are listed under (and counted inside) their parent
+enum class ProfileSection {
+    FRAME, // everything between two endFrame() calls, including waits
+    GAME_UPDATE,
+    GAME_PLAYER,
+    GAME_PROJECTILES,
+    GAME_OPPONENTS,
+    GAME_PARTICLES,
+    GAME_HEALTH_ITEMS,
+    GAME_COLLISIONS,
+    GAME_SPAWNING,
+    RENDER,
+    RENDER_WORLD,
+    RENDER_PARTICLES,
+    RENDER_LANDSCAPE,
+    RENDER_MINIMAP,
+    RENDER_HUD,
+    RENDER_TEXT,
+    AUDIO, // the audio thread carrying out sound commands
+    COUNT
+};
+
+// per-frame phase timings. scoped timers add their elapsed ticks to the current
+// frame; endFrame() turns the sums into one sample per section, kept in a rolling
+// window for min/avg/p99 and (when tracing) in a full per-frame trace for export
+class Profiler {
+public:
+    struct Stats {
+        float minMs = 0.0f;
+        float avgMs = 0.0f;
+        float p99Ms = 0.0f;
+    };
+
+    static constexpr int SECTION_COUNT = static_cast<int>(ProfileSection::COUNT);
+    static constexpr int WINDOW_FRAMES = 240; // ~4 seconds at 60 fps
+
+    // delete copy constructor and assignment operator to enforce singleton
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+
+    // get singleton instance
+    static Profiler& getInstance();
+
+    // safe to call from any thread
+    void add(ProfileSection section, Uint64 ticks) {
+        m_current[static_cast<int>(section)].fetch_add(ticks, std::memory_order_relaxed);
+    }
+
+    void endFrame();
+    Stats getStats(ProfileSection section) const;
+    static const char* getName(ProfileSection section);
+
+    // keeps every frame's samples so writeTrace() can dump them at exit
+    void setTraceEnabled(bool enabled) { m_traceEnabled = enabled; }
+    // CSV, or JSON when the path ends in .json
+    bool writeTrace(const std::string& path) const;
+
+private:
+    Profiler();
+    ~Profiler() = default;
+
+    double m_msPerTick;
+    Uint64 m_lastFrameEnd = 0;
+    std::atomic<Uint64> m_current[SECTION_COUNT];
+
+    float m_history[SECTION_COUNT][WINDOW_FRAMES] = {};
+    int m_historyPos = 0;
+    int m_historyCount = 0;
+
+    bool m_traceEnabled = false;
+    std::vector<float> m_trace; // SECTION_COUNT floats per frame
+    mutable std::vector<float> m_sortScratch;
+
+    bool writeCsv(const std::string& path) const;
+    bool writeJson(const std::string& path) const;
+};
+
+// adds the time between construction and destruction to a section
+class ScopedTimer {
+public:
+    explicit ScopedTimer(ProfileSection section)
+        : m_section(section), m_start(SDL_GetPerformanceCounter()) {}
+    ~ScopedTimer() { Profiler::getInstance().add(m_section, SDL_GetPerformanceCounter() - m_start); }
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    ProfileSection m_section;
+    Uint64 m_start;
+};
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#ifdef SDL3DEFENDER_PROFILING
+#define PROFILE_SCOPE(section) ScopedTimer PROFILE_CONCAT(profileScope_, __LINE__)(section)
+#else
+#define PROFILE_SCOPE(section) ((void)0)
+#endif
@@ -0,0 +1,63 @@
+#pragma once
+#include <cstdint>
+
+// xoshiro128** generator - small, fast and reproducible.
+// each Rng is an independent stream; give every system (or thread) its own instance
+// instead of sharing libc rand() state
+class Rng {
+public:
+    explicit Rng(uint64_t seed = 0, uint64_t stream = 0) { reseed(seed, stream); }
+
+    // expands (seed, stream) into the 128-bit state with splitmix64,
+    // so different streams of the same seed are uncorrelated
+    void reseed(uint64_t seed, uint64_t stream = 0) {
+        uint64_t sm = seed ^ (stream * 0xD1B54A32D192ED03ull);
+        uint64_t a = splitmix64(sm);
+        uint64_t b = splitmix64(sm);
+        m_s[0] = static_cast<uint32_t>(a);
+        m_s[1] = static_cast<uint32_t>(a >> 32);
+        m_s[2] = static_cast<uint32_t>(b);
+        m_s[3] = static_cast<uint32_t>(b >> 32);
+        if ((m_s[0] | m_s[1] | m_s[2] | m_s[3]) == 0) m_s[0] = 1; // all-zero state is a fixed point
+    }
+
+    uint32_t next() {
+        const uint32_t result = rotl(m_s[1] * 5, 7) * 9;
+        const uint32_t t = m_s[1] << 9;
+        m_s[2] ^= m_s[0];
+        m_s[3] ^= m_s[1];
+        m_s[1] ^= m_s[2];
+        m_s[0] ^= m_s[3];
+        m_s[2] ^= t;
+        m_s[3] = rotl(m_s[3], 11);
+        return result;
+    }
+
+    // [0, n) for n > 0 - replacement for rand() % n (multiply-shift, no modulo bias worth caring about)
+    int nextInt(int n) {
+        return static_cast<int>((static_cast<uint64_t>(next()) * static_cast<uint32_t>(n)) >> 32);
+    }
+
+    // [min, max] inclusive
+    int range(int min, int max) { return min + nextInt(max - min + 1); }
+
+    // [0, 1)
+    float nextFloat() { return static_cast<float>(next() >> 8) * (1.0f / 16777216.0f); }
+
+    // [min, max)
+    float range(float min, float max) { return min + nextFloat() * (max - min); }
+
+    bool chance(float probability) { return nextFloat() < probability; }
+
+private:
+    uint32_t m_s[4];
+
+    static uint32_t rotl(uint32_t x, int k) { return (x << k) | (x >> (32 - k)); }
+
+    static uint64_t splitmix64(uint64_t& x) {
+        uint64_t z = (x += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+};
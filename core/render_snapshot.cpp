@@ -0,0 +1,105 @@
+#include "render_snapshot.h"
+#include <algorithm>
+#include "../entities/health_item.h"
+
+void RenderSnapshot::capture(const GameStateData& s) {
+    // screens and HUD
+    state = s.state;
+    waitingForHighScore = s.waitingForHighScore;
+    highScoreIndex = s.highScoreIndex;
+    highScoreNameInput = s.highScoreNameInput;
+    playerScore = s.playerScore;
+    worldHealth = s.worldHealth;
+    cameraX = s.cameraX;
+    previousCameraX = s.previousCameraX;
+    worldWidth = s.worldWidth;
+    worldHeight = s.worldHeight;
+    screenWidth = s.screenWidth;
+
+    hasPlayer = s.player != nullptr;
+    if (hasPlayer) {
+        player = { s.player->getBounds(), s.player->getPreviousPosition() };
+        playerFacingLeft = s.player->getFacing() == Direction::LEFT;
+        playerHealth = s.player->getHealth();
+        playerMaxHealth = s.player->getMaxHealth();
+    }
+
+    // menus only need the fields above
+    for (OpponentLayer& layer : opponents) layer.sprites.clear();
+    projectiles.clear();
+    particles.clear();
+    landscape.clear();
+    minimapGround.clear();
+    healthItems.clear();
+    if (state != GameStateData::State::PLAYING) return;
+
+    int layerIndex = 0;
+    s.opponents.forEachPool([&](const auto& pool) {
+        OpponentLayer& layer = opponents[layerIndex++];
+        if (pool.empty()) return;
+        layer.spriteId = pool.begin()->getSpriteId();
+        for (const auto& o : pool) {
+            if (o.isAlive()) layer.sprites.push_back({ o.getBounds(), o.getPreviousPosition() });
+        }
+    });
+
+    for (const auto& p : s.projectiles) {
+        if (p.getAge() >= p.getLifetime()) continue;
+        Line line;
+        line.color = p.getColor();
+        if (p.getFaction() == Faction::PLAYER) {
+            float beamY = p.getSpawnY();
+            float startX = p.getSpawnX();
+            bool goingRight = (p.getVelocity().x > 0);
+
+            // find visual end point
+            float rawEndX = goingRight ? s.worldWidth : 0.0f;
+            float screenEdgeX = goingRight ? s.cameraX + s.screenWidth : s.cameraX; // no need to march past what's visible
+            float landscapeEndX = s.terrain.getBeamEndX(startX, beamY, goingRight, screenEdgeX);
+
+            // use the closer endpoint (landscape or world edge)
+            float endX = goingRight ? std::min(rawEndX, landscapeEndX) : std::max(0.0f, landscapeEndX);
+            line.start = { startX, beamY };
+            line.end = { endX, beamY };
+            line.previousEnd = line.end;
+        } else {
+            // full intended endpoint, now and one tick ago, each clipped to the landscape
+            auto clippedEnd = [&](float x, float y) {
+                float intendedEndX = p.getSpawnX() + (x - p.getSpawnX()) * 4.0f;
+                float intendedEndY = p.getSpawnY() + (y - p.getSpawnY()) * 4.0f;
+                return s.terrain.clipRay(p.getSpawnX(), p.getSpawnY(), intendedEndX, intendedEndY);
+            };
+            SDL_FPoint previous = p.getPreviousPosition();
+            line.start = { p.getSpawnX(), p.getSpawnY() };
+            line.end = clippedEnd(p.getCurrentX(), p.getCurrentY());
+            line.previousEnd = clippedEnd(previous.x, previous.y);
+        }
+        projectiles.push_back(line);
+    }
+
+    const float toUnit = 1.0f / 255.0f;
+    for (size_t i = 0; i < s.particles.size(); ++i) {
+        float size = s.particles.getCurrentSize(i);
+        SDL_FColor color = { s.particles.getR(i) * toUnit, s.particles.getG(i) * toUnit, s.particles.getB(i) * toUnit, s.particles.getAlpha(i) * toUnit };
+        particles.push_back({ { s.particles.getX(i), s.particles.getY(i), size, size }, color });
+    }
+
+    // only the vertices on screen (anywhere between the two camera positions), and
+    // the whole world at minimap resolution
+    float viewLeft = std::min(s.cameraX, s.previousCameraX);
+    float viewRight = std::max(s.cameraX, s.previousCameraX) + s.screenWidth;
+    s.terrain.getPoints(viewLeft, viewRight, landscape);
+    if (!s.terrain.empty()) {
+        minimapGround.resize(MINIMAP_WIDTH + 1);
+        float worldPerPixel = s.worldWidth / MINIMAP_WIDTH;
+        for (int i = 0; i <= MINIMAP_WIDTH; ++i) {
+            minimapGround[i] = s.terrain.getGroundYAt(i * worldPerPixel);
+        }
+    }
+
+    for (const auto& item : s.healthItems) {
+        if (!item || !item->isAlive()) continue;
+        Uint8 alpha = item->isBlinking() ? static_cast<Uint8>(item->getBlinkAlpha()) : 255;
+        healthItems.push_back({ { item->getBounds(), item->getPreviousPosition() }, item->getSpriteId(), alpha });
+    }
+}
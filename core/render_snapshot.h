@@ -0,0 +1,83 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <string>
+#include <vector>
+#include "game.h"
+
+// everything Platform draws, copied out of GameStateData at the end of a tick.
+// the simulation thread fills one while the main thread draws another, so nothing
+// in here points into live game state (sprites are referred to by SpriteId).
+// terrain lookups (beam ends, shot clipping, landscape) are resolved while
+// capturing, so the renderer never touches the terrain.
+// moving things carry where they were one tick earlier as well, so the renderer
+// can draw them part way between the two ticks (see getAlpha)
+struct RenderSnapshot {
+    static constexpr int MINIMAP_WIDTH = 210; // one ground sample per minimap pixel (plus one)
+    static constexpr int OPPONENT_LAYERS = 3;  // one per opponent pool
+
+    struct Sprite {
+        SDL_FRect bounds; // world coordinates
+        SDL_FPoint previous; // bounds.x/y one tick earlier
+    };
+    struct OpponentLayer {
+        SpriteId spriteId = SpriteId::BASIC_OPPONENT;
+        std::vector<Sprite> sprites; // live opponents only
+    };
+    struct Line {
+        SDL_FPoint start; // world coordinates
+        SDL_FPoint end;
+        SDL_FPoint previousEnd; // shots grow from a fixed start
+        SDL_Color color;
+    };
+    struct ParticleQuad {
+        SDL_FRect bounds; // world coordinates
+        SDL_FColor color;
+    };
+    struct HealthItemSprite {
+        Sprite sprite;
+        SpriteId spriteId;
+        Uint8 alpha; // blinks before it disappears
+    };
+
+    // when the tick this was captured after became due, and the tick length
+    Uint64 tickTimeNs = 0;
+    Uint64 tickDurationNs = 0;
+
+    // screens and HUD
+    GameStateData::State state = GameStateData::State::MENU;
+    bool waitingForHighScore = false;
+    int highScoreIndex = -1;
+    std::string highScoreNameInput;
+    int playerScore = 0;
+    int worldHealth = 0;
+    float cameraX = 0.0f;
+    float previousCameraX = 0.0f;
+    float worldWidth = 0.0f;
+    float worldHeight = 0.0f;
+    float screenWidth = 0.0f;
+
+    // world
+    bool hasPlayer = false;
+    Sprite player = {};
+    bool playerFacingLeft = false;
+    int playerHealth = 0;
+    int playerMaxHealth = 1;
+    OpponentLayer opponents[OPPONENT_LAYERS];
+    std::vector<Line> projectiles; // already clipped against the terrain
+    std::vector<ParticleQuad> particles;
+    std::vector<SDL_FPoint> landscape;     // vertices on screen at either tick
+    std::vector<float> minimapGround;      // MINIMAP_WIDTH + 1 ground heights across the world
+    std::vector<HealthItemSprite> healthItems;
+
+    // overwrites every field but the tick timing; containers keep their capacity
+    void capture(const GameStateData& state);
+
+    // how far (0..1) from the previous tick to this one to draw at nowNs. the
+    // newest tick is reached just as the next one becomes due, so what's on
+    // screen trails the simulation by up to one tick
+    float getAlpha(Uint64 nowNs) const {
+        if (tickDurationNs == 0 || nowNs <= tickTimeNs) return 0.0f;
+        float alpha = static_cast<float>(nowNs - tickTimeNs) / static_cast<float>(tickDurationNs);
+        return alpha < 1.0f ? alpha : 1.0f;
+    }
+};
@@ -1,6 +1,25 @@
 #include "sound_manager.h"
 #include <iostream>
 #include <algorithm>
+#include "asset_archive.h"
+#include "config.h"
+#include "profiler.h"
+
+namespace {
+    // indexed by SoundEffect. higher priority steals voices from lower; maxVoices
+    // caps how many copies of one effect overlap
+    struct EffectInfo {
+        const std::string* file;
+        int priority;
+        int maxVoices;
+    };
+    const EffectInfo EFFECTS[] = {
+        { &Config::Sounds::GAME_START, 3, 1 },
+        { &Config::Sounds::GAME_OVER, 3, 1 },
+        { &Config::Sounds::PLAYER_SHOOT, 2, 4 },
+        { &Config::Sounds::OPPONENT_EXPLODE, 1, 6 },
+    };
+}
 
 SoundManager& SoundManager::getInstance() {
     static SoundManager instance;
@@ -28,6 +47,29 @@ bool SoundManager::initialize(SDL_AudioDeviceID deviceID, const SDL_AudioSpec& s
 
     m_mixerInstance = std::shared_ptr<MIX_Mixer>(mixer, MIX_Mixer_Deleter{});
 
+    // every voice up front, so playing never creates a track
+    for (Voice& voice : m_voices) {
+        voice = Voice{};
+        voice.track = MIX_CreateTrack(mixer);
+        if (!voice.track) {
+            SDL_Log("SoundManager: Failed to create a voice track: %s", SDL_GetError());
+        }
+    }
+
+    m_wake = SDL_CreateSemaphore(0);
+    if (!m_wake) {
+        SDL_Log("SoundManager: Failed to create the audio thread semaphore: %s", SDL_GetError());
+        for (Voice& voice : m_voices) {
+            if (voice.track) MIX_DestroyTrack(voice.track);
+            voice = Voice{};
+        }
+        m_mixerInstance.reset();
+        MIX_Quit();
+        return false;
+    }
+    m_audioRunning = true;
+    m_audioThread = std::thread(&SoundManager::audioLoop, this);
+
     m_initialized = true;
     SDL_Log("SoundManager: SDL_mixer initialized successfully with device %d.", deviceID);
     return true;
@@ -35,6 +77,20 @@ bool SoundManager::initialize(SDL_AudioDeviceID deviceID, const SDL_AudioSpec& s
 
 void SoundManager::shutdown() {
     if (m_initialized) {
+        // commands still queued are dropped; the thread exits on its next wake
+        m_audioRunning = false;
+        SDL_SignalSemaphore(m_wake);
+        if (m_audioThread.joinable()) m_audioThread.join();
+        SDL_DestroySemaphore(m_wake);
+        m_wake = nullptr;
+        if (m_droppedCommands > 0) SDL_Log("SoundManager: %d sound commands dropped (queue full).", m_droppedCommands);
+        m_droppedCommands = 0;
+
+        stopVoices();
+        for (Voice& voice : m_voices) {
+            if (voice.track) MIX_DestroyTrack(voice.track);
+            voice = Voice{};
+        }
         clearCache();
         m_mixerInstance.reset();
         m_initialized = false;
@@ -55,7 +111,8 @@ std::shared_ptr<MIX_Audio> SoundManager::getSound(const std::string& filepath) {
         return it->second;
     }
 
-    MIX_Audio* audio = MIX_LoadAudio(m_mixerInstance.get(), filepath.c_str(), true);
+    SDL_IOStream* io = AssetArchive::getInstance().openFile(filepath);
+    MIX_Audio* audio = io ? MIX_LoadAudio_IO(m_mixerInstance.get(), io, true, true) : nullptr;
     if (!audio) {
         SDL_Log("Failed to load sound '%s': %s", filepath.c_str(), SDL_GetError());
         return nullptr; 
@@ -67,10 +124,17 @@ std::shared_ptr<MIX_Audio> SoundManager::getSound(const std::string& filepath) {
     return sharedAudio;
 }
 
+void SoundManager::addSound(const std::string& filepath, MIX_Audio* audio) {
+    m_soundCache[filepath] = std::shared_ptr<MIX_Audio>(audio, MIX_Audio_Deleter{});
+}
+
 void SoundManager::clearCache() {
     if (m_initialized) {
         SDL_Log("SoundManager: Clearing sound cache and destroying %zu audio objects.", m_soundCache.size());
+        stopVoices(); // nothing may keep playing audio that's about to be destroyed
+        for (Effect& effect : m_effects) effect = Effect{};
         m_soundCache.clear(); // will call the deleter for each MIX_Audio
+        m_soundPack.reset(); // only once nothing plays from it
     }
 }
 
@@ -78,47 +142,124 @@ SoundManager::~SoundManager() {
     shutdown(); 
 }
 
-bool SoundManager::playSound(const std::string& filepath, MIX_Mixer* mixer) {
-    if (!m_initialized || !mixer) {
-         SDL_Log("SoundManager: Cannot play sound, not initialized or mixer is null.");
-         return false;
+void SoundManager::bindEffects() {
+    static_assert(sizeof(EFFECTS) / sizeof(EFFECTS[0]) == EFFECT_COUNT, "one entry per SoundEffect");
+    for (int i = 0; i < EFFECT_COUNT; ++i) {
+        auto audio = getSound(*EFFECTS[i].file);
+        m_effects[i] = Effect{};
+        m_effects[i].audio = audio.get(); // the cache keeps it alive
     }
+}
 
-    auto audioSharedPtr = getSound(filepath);
-    if (!audioSharedPtr) {
-        SDL_Log("SoundManager: Cannot play sound '%s', failed to load or retrieve.", filepath.c_str());
-        return false;
-    }
+void SoundManager::play(SoundEffect effect) {
+    Command command;
+    command.type = Command::Type::PLAY;
+    command.effect = static_cast<int>(effect);
+    queue(command);
+}
 
-    // create a temporary track for playback
-    MIX_Track* track = MIX_CreateTrack(mixer);
-    if (!track) {
-        SDL_Log("SoundManager: Failed to create track for sound '%s': %s", filepath.c_str(), SDL_GetError());
-        return false;
+void SoundManager::stopAll() {
+    Command command;
+    command.type = Command::Type::STOP_ALL;
+    queue(command);
+}
+
+void SoundManager::setMasterGain(float gain) {
+    Command command;
+    command.type = Command::Type::SET_GAIN;
+    command.gain = gain;
+    queue(command);
+}
+
+void SoundManager::queue(const Command& command) {
+    if (!m_audioRunning.load(std::memory_order_relaxed)) return;
+    Command stamped = command;
+    stamped.timeNs = SDL_GetTicksNS();
+    if (!m_commands.push(stamped)) {
+        ++m_droppedCommands; // the audio thread is far behind; a lost sound beats a stalled tick
+        return;
     }
+    SDL_SignalSemaphore(m_wake);
+}
 
-    auto sharedTrack = std::shared_ptr<MIX_Track>(track, MIX_Track_Deleter{});
+// audio thread
+void SoundManager::audioLoop() {
+    Command command;
+    while (true) {
+        SDL_WaitSemaphore(m_wake);
+        if (!m_audioRunning.load(std::memory_order_relaxed)) break;
 
-    if (!MIX_SetTrackAudio(sharedTrack.get(), audioSharedPtr.get())) {
-        SDL_Log("SoundManager: Failed to assign audio to track for sound '%s': %s", filepath.c_str(), SDL_GetError());
-        return false; 
+        PROFILE_SCOPE(ProfileSection::AUDIO);
+        while (m_commands.pop(command)) execute(command);
     }
+}
 
-    SDL_PropertiesID options = SDL_CreateProperties();
-    if (!options) {
-        SDL_Log("SoundManager: Failed to create properties for sound '%s': %s", filepath.c_str(), SDL_GetError());
-        return false;
+void SoundManager::execute(const Command& command) {
+    switch (command.type) {
+        case Command::Type::PLAY:
+            startEffect(command.effect, command.timeNs);
+            break;
+        case Command::Type::STOP_ALL:
+            stopVoices();
+            break;
+        case Command::Type::SET_GAIN:
+            MIX_SetMasterGain(m_mixerInstance.get(), command.gain);
+            break;
     }
+}
 
-    // play once
-    bool playSuccess = MIX_PlayTrack(sharedTrack.get(), options);
-    SDL_DestroyProperties(options);
+void SoundManager::startEffect(int index, Uint64 timeNs) {
+    if (index < 0 || index >= EFFECT_COUNT) return;
 
-    if (!playSuccess) {
-        SDL_Log("SoundManager: Failed to play track for sound '%s': %s", filepath.c_str(), SDL_GetError());
-        return false;
+    Effect& state = m_effects[index];
+    if (!state.audio) return; // failed to load (already logged)
+
+    // the same effect again within a few ms sounds no different, so it's dropped
+    if (state.lastStartNs != 0 && timeNs - state.lastStartNs < COALESCE_NS) return;
+
+    const EffectInfo& info = EFFECTS[index];
+    Voice* voice = findVoice(index, info.priority, info.maxVoices);
+    if (!voice) return; // everything playing matters more
+
+    if (MIX_TrackPlaying(voice->track)) MIX_StopTrack(voice->track, 0);
+    if (!MIX_SetTrackAudio(voice->track, state.audio) || !MIX_PlayTrack(voice->track, 0)) return;
+
+    voice->effect = index;
+    voice->priority = info.priority;
+    voice->startNs = timeNs;
+    state.lastStartNs = timeNs;
+}
+
+SoundManager::Voice* SoundManager::findVoice(int effect, int priority, int maxVoices) {
+    Voice* idle = nullptr;
+    Voice* oldestSame = nullptr; // of this effect
+    Voice* victim = nullptr;     // least important, then oldest
+    int playingSame = 0;
+    for (Voice& voice : m_voices) {
+        if (!voice.track) continue;
+        if (!MIX_TrackPlaying(voice.track)) {
+            if (!idle) idle = &voice;
+            continue;
+        }
+        if (voice.effect == effect) {
+            ++playingSame;
+            if (!oldestSame || voice.startNs < oldestSame->startNs) oldestSame = &voice;
+        }
+        if (!victim || voice.priority < victim->priority || (voice.priority == victim->priority && voice.startNs < victim->startNs)) {
+            victim = &voice;
+        }
     }
 
-    SDL_Log("SoundManager: Played sound '%s'.", filepath.c_str());
-    return true;
-}
\ No newline at end of file
+    // at its limit an effect restarts its own oldest voice rather than taking another
+    if (playingSame >= maxVoices) return oldestSame;
+    if (idle) return idle;
+    return (victim && victim->priority <= priority) ? victim : nullptr;
+}
+
+void SoundManager::stopVoices() {
+    for (Voice& voice : m_voices) {
+        if (voice.track) MIX_StopTrack(voice.track, 0);
+        voice.effect = -1;
+    }
+}
+// END: audio thread
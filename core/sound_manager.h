@@ -2,9 +2,14 @@
 
 #include <SDL3/SDL.h>
 #include <SDL3_mixer/SDL_mixer.h>
+#include <atomic>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <memory>
+#include "sound_pack.h"
+#include "sound_sink.h"
+#include "spsc_queue.h"
 
 // custom deleter for MIX_Audio
 struct MIX_Audio_Deleter {
@@ -24,35 +29,91 @@ struct MIX_Mixer_Deleter {
     }
 };
 
-// custom deleter for MIX_Track
-struct MIX_Track_Deleter {
-    void operator()(MIX_Track* track) const {
-        if (track) {
-            MIX_DestroyTrack(track);
-        }
-    }
-};
-
-class SoundManager {
+// sound effects play on a fixed pool of tracks ("voices") created once at
+// initialize(). each effect is bound to its loaded audio once (bindEffects), so
+// starting one is an array lookup and a track restart: no allocation, lookup by
+// name or logging. when every voice is busy the least important, oldest one is
+// stolen; each effect also has a voice limit and a short coalescing window, so
+// twenty explosions in one tick start one or two voices, not twenty.
+// play(), stopAll() and setMasterGain() only queue a command: a dedicated audio
+// thread makes the mixer calls, so the simulation thread never waits on the
+// mixer's lock. all three must be called from one thread (the simulation's)
+class SoundManager : public SoundSink {
 public:
     SoundManager(const SoundManager&) = delete;
     SoundManager& operator=(const SoundManager&) = delete;
 
     static SoundManager& getInstance();
     std::shared_ptr<MIX_Audio> getSound(const std::string& filepath);
+    // caches a sound loaded elsewhere (AssetLoader); the manager destroys it
+    void addSound(const std::string& filepath, MIX_Audio* audio);
+    // keeps the mapped pack that cached sounds play from alive until clearCache()
+    void setSoundPack(std::unique_ptr<SoundPack> pack) { m_soundPack = std::move(pack); }
     void clearCache();
     bool initialize(SDL_AudioDeviceID deviceID, const SDL_AudioSpec& spec);
     void shutdown();
 
-    bool playSound(const std::string& filepath, MIX_Mixer* mixer);
+    // resolves every SoundEffect to its cached audio; call once the sounds are loaded
+    void bindEffects();
+
+    // SoundSink: queues a game sound effect for the audio thread
+    void play(SoundEffect effect) override;
+    void stopAll();
+    void setMasterGain(float gain);
 
     MIX_Mixer* getMixerInstance() const { return m_mixerInstance.get(); }
 
 private:
     SoundManager() = default;
     ~SoundManager();
+
+    static constexpr int VOICE_COUNT = 16;
+    static constexpr int EFFECT_COUNT = static_cast<int>(SoundEffect::OPPONENT_EXPLODE) + 1;
+    static constexpr Uint64 COALESCE_NS = 30 * SDL_NS_PER_MS; // repeats closer than this are dropped
+
+    struct Voice {
+        MIX_Track* track = nullptr;
+        int effect = -1; // last effect started on it
+        int priority = 0;
+        Uint64 startNs = 0;
+    };
+    struct Effect {
+        MIX_Audio* audio = nullptr; // owned by m_soundCache
+        Uint64 lastStartNs = 0;
+    };
+
     std::unordered_map<std::string, std::shared_ptr<MIX_Audio>> m_soundCache;
+    std::unique_ptr<SoundPack> m_soundPack;
     bool m_initialized = false; 
     // store the mixer instance created during initialization
     std::shared_ptr<MIX_Mixer> m_mixerInstance;
+
+    Voice m_voices[VOICE_COUNT];   // audio thread only (once running)
+    Effect m_effects[EFFECT_COUNT];
+
+    struct Command {
+        enum class Type : Uint8 {
+            PLAY,
+            STOP_ALL,
+            SET_GAIN
+        };
+        Type type = Type::PLAY;
+        int effect = 0;
+        float gain = 1.0f;
+        Uint64 timeNs = 0; // when it was queued; coalescing goes by this, not by when it runs
+    };
+    static constexpr size_t COMMAND_CAPACITY = 256;
+
+    SpscQueue<Command, COMMAND_CAPACITY> m_commands;
+    SDL_Semaphore* m_wake = nullptr; // signalled once per queued command
+    std::thread m_audioThread;
+    std::atomic<bool> m_audioRunning{false};
+    int m_droppedCommands = 0; // queue was full; producer only
+
+    void queue(const Command& command);
+    void audioLoop();
+    void execute(const Command& command);
+    void startEffect(int index, Uint64 timeNs);
+    void stopVoices();
+    Voice* findVoice(int effect, int priority, int maxVoices);
 };
\ No newline at end of file
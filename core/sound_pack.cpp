@@ -0,0 +1,167 @@
+#include "sound_pack.h"
+#include <SDL3_mixer/SDL_mixer.h>
+#include <algorithm>
+#include <filesystem>
+#include <iterator>
+#include "asset_archive.h"
+#include "binary_io.h"
+
+using namespace BinaryIO;
+
+namespace {
+    const char MAGIC[4] = { 'S', 'D', 'S', 'P' };
+    const uint16_t VERSION = 3; // 3 stamps archived sources by content hash instead of mtime
+    const size_t DATA_ALIGNMENT = 16;
+
+    // the current version of a source, without reading it
+    SoundPack::Source getCurrentSource(const std::string& file) {
+        SoundPack::Source source;
+        if (AssetArchive::getInstance().getFileInfo(file, source.size, source.version)) {
+            source.exists = true;
+            return source;
+        }
+        std::error_code error;
+        auto size = std::filesystem::file_size(file, error);
+        if (error) return source;
+        auto time = std::filesystem::last_write_time(file, error);
+        if (error) return source;
+        source.size = size;
+        source.version = static_cast<uint64_t>(time.time_since_epoch().count());
+        source.exists = true;
+        return source;
+    }
+}
+
+bool SoundPack::open(const std::string& path, const std::vector<std::string>& files, const SDL_AudioSpec& spec) {
+    close();
+    std::error_code error;
+    if (!std::filesystem::exists(path, error)) return false; // first run: nothing to map yet
+    if (!m_file.open(path)) return false;
+
+    Reader in{ m_file.getData(), m_file.getSize() };
+    std::string magic = in.str(sizeof(MAGIC));
+    bool valid = in.ok && std::equal(std::begin(MAGIC), std::end(MAGIC), magic.begin()) && in.u16() == VERSION;
+    valid = valid && static_cast<int>(in.u32()) == spec.freq && in.u32() == static_cast<uint32_t>(spec.format) && static_cast<int>(in.u32()) == spec.channels;
+    uint32_t count = valid ? in.u32() : 0;
+
+    for (uint32_t i = 0; valid && i < count; ++i) {
+        std::string file = in.string();
+        uint64_t sourceSize = in.u64();
+        uint64_t sourceVersion = in.u64();
+        uint64_t offset = in.u64();
+        uint64_t bytes = in.u64();
+        if (!in.ok || offset > m_file.getSize() || bytes > m_file.getSize() - offset) {
+            valid = false;
+            break;
+        }
+
+        // a source that's gone is fine (the pack may ship without them), a changed one is not
+        Source source = getCurrentSource(file);
+        if (source.exists && (source.size != sourceSize || source.version != sourceVersion)) {
+            SDL_Log("SoundPack: '%s' changed since '%s' was built.", file.c_str(), path.c_str());
+            valid = false;
+            break;
+        }
+        m_entries.push_back({ file, m_file.getData() + offset, static_cast<size_t>(bytes) });
+    }
+
+    for (const std::string& file : files) {
+        size_t bytes = 0;
+        if (valid && !find(file, bytes)) valid = false;
+    }
+    if (!valid) {
+        SDL_Log("SoundPack: '%s' is stale or doesn't match the device format, rebuilding.", path.c_str());
+        close();
+        return false;
+    }
+    SDL_Log("SoundPack: Mapped %zu sounds from '%s'.", m_entries.size(), path.c_str());
+    return true;
+}
+
+void SoundPack::close() {
+    m_entries.clear();
+    m_file.close();
+}
+
+const void* SoundPack::find(const std::string& file, size_t& bytes) const {
+    for (const Entry& entry : m_entries) {
+        if (entry.file == file) {
+            bytes = entry.bytes;
+            return entry.data;
+        }
+    }
+    return nullptr;
+}
+
+bool SoundPack::decode(const std::string& file, const SDL_AudioSpec& spec, std::vector<Uint8>& pcm, Source& source) {
+    pcm.clear();
+    source = getCurrentSource(file);
+    SDL_IOStream* io = AssetArchive::getInstance().openFile(file);
+
+    // archived: hash the bytes about to be decoded (matching the packer's hash
+    // unless the archive is damaged), then rewind for the decoder
+    if (io && AssetArchive::getInstance().contains(file)) {
+        Uint8 chunk[16 * 1024];
+        size_t bytes = 0;
+        source.size = 0;
+        source.version = HASH_SEED;
+        while ((bytes = SDL_ReadIO(io, chunk, sizeof(chunk))) > 0) {
+            source.version = hash(chunk, bytes, source.version);
+            source.size += bytes;
+        }
+        if (SDL_SeekIO(io, 0, SDL_IO_SEEK_SET) != 0) {
+            SDL_CloseIO(io);
+            io = nullptr;
+        }
+    }
+
+    MIX_AudioDecoder* decoder = io ? MIX_CreateAudioDecoder_IO(io, true, 0) : nullptr;
+    if (!decoder) {
+        SDL_Log("SoundPack: Failed to open '%s' for decoding: %s", file.c_str(), SDL_GetError());
+        return false;
+    }
+
+    // the decoder converts to spec as it goes
+    Uint8 chunk[16 * 1024];
+    int bytes = 0;
+    while ((bytes = MIX_DecodeAudio(decoder, chunk, sizeof(chunk), &spec)) > 0) {
+        pcm.insert(pcm.end(), chunk, chunk + bytes);
+    }
+    MIX_DestroyAudioDecoder(decoder);
+    if (bytes < 0 || pcm.empty()) {
+        SDL_Log("SoundPack: Failed to decode '%s': %s", file.c_str(), SDL_GetError());
+        pcm.clear();
+        return false;
+    }
+    return true;
+}
+
+bool SoundPack::write(const std::string& path, const std::vector<std::string>& files, const std::vector<std::vector<Uint8>>& pcm,
+                      const std::vector<Source>& sources, const SDL_AudioSpec& spec) {
+    // header and index first, to know where the samples start
+    std::vector<uint8_t> header;
+    header.insert(header.end(), std::begin(MAGIC), std::end(MAGIC));
+    putU16(header, VERSION);
+    putU32(header, static_cast<uint32_t>(spec.freq));
+    putU32(header, static_cast<uint32_t>(spec.format));
+    putU32(header, static_cast<uint32_t>(spec.channels));
+    putU32(header, static_cast<uint32_t>(files.size()));
+
+    size_t indexBytes = 0;
+    for (const std::string& file : files) indexBytes += 2 + file.size() + 8 * 4;
+    size_t offset = alignUp(header.size() + indexBytes, DATA_ALIGNMENT);
+    for (size_t i = 0; i < files.size(); ++i) {
+        putString(header, files[i]);
+        putU64(header, sources[i].size);
+        putU64(header, sources[i].version);
+        putU64(header, offset);
+        putU64(header, pcm[i].size());
+        offset = alignUp(offset + pcm[i].size(), DATA_ALIGNMENT);
+    }
+
+    std::vector<Blob> blobs;
+    for (const std::vector<Uint8>& samples : pcm) blobs.push_back({ samples.data(), samples.size() });
+    if (!writeFileAtomically(path, header, blobs, DATA_ALIGNMENT)) return false;
+    SDL_Log("SoundPack: Wrote %zu decoded sounds to '%s'.", files.size(), path.c_str());
+    return true;
+}
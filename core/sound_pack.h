@@ -0,0 +1,50 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <string>
+#include <vector>
+#include "mapped_file.h"
+
+// the game's sounds decoded once to the output device's format and kept in one
+// file, so later runs map that file and hand the samples to the mixer as they
+// are: no codec work at startup and no resampling while playing. the pack
+// records which version of each source it was decoded from, and is only used
+// while all of them (and the device format) still match.
+// layout (little-endian): magic "SDSP", u16 version, i32 freq, u32 format,
+// i32 channels, u32 count, then per sound u16 name length, name, u64 source
+// size, u64 source version, u64 offset, u64 bytes; samples start on 16-byte boundaries
+class SoundPack {
+public:
+    // which version of a source file a sound was decoded from: its content hash
+    // when it comes from the asset archive (the packer records it, so checking
+    // costs nothing), its modification time when it's a loose file
+    struct Source {
+        uint64_t size = 0;
+        uint64_t version = 0;
+        bool exists = false;
+    };
+
+    // maps the pack at path if it holds every file in `files`, up to date and in `spec`
+    bool open(const std::string& path, const std::vector<std::string>& files, const SDL_AudioSpec& spec);
+    void close();
+    bool isOpen() const { return m_file.isOpen(); }
+
+    // decoded samples of `file`, valid while the pack stays open; null if it isn't in the pack
+    const void* find(const std::string& file, size_t& bytes) const;
+
+    // decodes one sound to `spec` and reports what it was decoded from; safe to
+    // run on several worker threads at once
+    static bool decode(const std::string& file, const SDL_AudioSpec& spec, std::vector<Uint8>& pcm, Source& source);
+    // writes (replaces) a pack of sounds decoded with decode()
+    static bool write(const std::string& path, const std::vector<std::string>& files, const std::vector<std::vector<Uint8>>& pcm,
+                      const std::vector<Source>& sources, const SDL_AudioSpec& spec);
+
+private:
+    struct Entry {
+        std::string file;
+        const Uint8* data;
+        size_t bytes;
+    };
+
+    MappedFile m_file;
+    std::vector<Entry> m_entries;
+};
@@ -0,0 +1,18 @@
+#pragma once
+
+// sound effects the simulation can trigger
+enum class SoundEffect {
+    GAME_START,
+    GAME_OVER,
+    PLAYER_SHOOT,
+    OPPONENT_EXPLODE
+};
+
+// Game routes its audio side effects through this interface instead of
+// reaching into SoundManager, so the simulation builds and runs without SDL_mixer.
+// a null sink (the default) means the effect is simply dropped
+class SoundSink {
+public:
+    virtual ~SoundSink() = default;
+    virtual void play(SoundEffect effect) = 0;
+};
@@ -0,0 +1,78 @@
+#include "spatial_grid.h"
+#include <algorithm>
+#include <cmath>
+
+void SpatialGrid::reset(float cellSize) {
+    m_invCellSize = 1.0f / cellSize;
+    m_cellRefs = 0;
+    m_entries.clear();
+}
+
+void SpatialGrid::insert(uint32_t id, const SDL_FRect& bounds) {
+    Entry e;
+    e.id = id;
+    cellRange(bounds, e.x0, e.y0, e.x1, e.y1);
+    m_cellRefs += static_cast<size_t>(e.x1 - e.x0 + 1) * (e.y1 - e.y0 + 1);
+    m_entries.push_back(e);
+}
+
+void SpatialGrid::build() {
+    // ~2 buckets per (entry, cell) pair keeps unrelated cells from sharing buckets
+    uint32_t bucketCount = 16;
+    while (bucketCount < m_cellRefs * 2) bucketCount <<= 1;
+    m_bucketMask = bucketCount - 1;
+    m_bucketStart.assign(bucketCount + 1, 0);
+
+    // count entries per bucket
+    for (const Entry& e : m_entries) {
+        for (int cy = e.y0; cy <= e.y1; ++cy) {
+            for (int cx = e.x0; cx <= e.x1; ++cx) {
+                ++m_bucketStart[bucketOf(cx, cy) + 1];
+            }
+        }
+    }
+
+    // prefix sum -> first slot of each bucket
+    for (size_t i = 1; i < m_bucketStart.size(); ++i) {
+        m_bucketStart[i] += m_bucketStart[i - 1];
+    }
+
+    // scatter ids into their buckets' slots (so each bucket keeps insertion order)
+    m_bucketItems.resize(m_bucketStart.back());
+    m_bucketCursor.assign(m_bucketStart.begin(), m_bucketStart.end() - 1);
+    for (const Entry& e : m_entries) {
+        for (int cy = e.y0; cy <= e.y1; ++cy) {
+            for (int cx = e.x0; cx <= e.x1; ++cx) {
+                m_bucketItems[m_bucketCursor[bucketOf(cx, cy)]++] = e.id;
+            }
+        }
+    }
+}
+
+void SpatialGrid::query(const SDL_FRect& area, std::vector<uint32_t>& out) const {
+    out.clear();
+    if (m_entries.empty()) return;
+
+    int x0, y0, x1, y1;
+    cellRange(area, x0, y0, x1, y1);
+    for (int cy = y0; cy <= y1; ++cy) {
+        for (int cx = x0; cx <= x1; ++cx) {
+            uint32_t bucket = bucketOf(cx, cy);
+            out.insert(out.end(), m_bucketItems.begin() + m_bucketStart[bucket], m_bucketItems.begin() + m_bucketStart[bucket + 1]);
+        }
+    }
+
+    // an entry spanning several cells shows up once per cell (or twice in one
+    // bucket when two of its cells hash together)
+    if (out.size() > 1) {
+        std::sort(out.begin(), out.end());
+        out.erase(std::unique(out.begin(), out.end()), out.end());
+    }
+}
+
+void SpatialGrid::cellRange(const SDL_FRect& bounds, int& x0, int& y0, int& x1, int& y1) const {
+    x0 = static_cast<int>(std::floor(bounds.x * m_invCellSize));
+    x1 = static_cast<int>(std::floor((bounds.x + bounds.w) * m_invCellSize));
+    y0 = static_cast<int>(std::floor(bounds.y * m_invCellSize));
+    y1 = static_cast<int>(std::floor((bounds.y + bounds.h) * m_invCellSize));
+}
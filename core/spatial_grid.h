@@ -0,0 +1,45 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <cstdint>
+#include <vector>
+
+// uniform-grid broadphase backed by a spatial hash, rebuilt from scratch every tick.
+// usage: reset() -> insert() everything -> build() -> query() as often as needed.
+// the bucket table is sized from the number of entries, not the world size, so a
+// rebuild costs O(entries) no matter how wide the world is. buckets are stored
+// contiguously (counting sort), so a rebuild allocates nothing once warmed up.
+// ids are whatever the caller uses to index its own arrays
+class SpatialGrid {
+public:
+    void reset(float cellSize);
+    void insert(uint32_t id, const SDL_FRect& bounds);
+    void build();
+
+    // replaces `out` with the ids of every entry hashed into a cell `area` touches,
+    // ascending (i.e. insertion order) and without duplicates.
+    // this is a broadphase: callers still do the exact overlap test
+    void query(const SDL_FRect& area, std::vector<uint32_t>& out) const;
+
+    size_t size() const { return m_entries.size(); }
+
+private:
+    struct Entry {
+        uint32_t id;
+        int x0, y0, x1, y1; // inclusive cell range
+    };
+
+    float m_invCellSize = 1.0f;
+    uint32_t m_bucketMask = 0;
+    size_t m_cellRefs = 0; // total (entry, cell) pairs
+
+    std::vector<Entry> m_entries;
+    std::vector<uint32_t> m_bucketStart; // prefix sums, one past the last bucket
+    std::vector<uint32_t> m_bucketItems;
+    std::vector<uint32_t> m_bucketCursor; // scratch for build()
+
+    void cellRange(const SDL_FRect& bounds, int& x0, int& y0, int& x1, int& y1) const;
+    uint32_t bucketOf(int cx, int cy) const {
+        uint32_t h = static_cast<uint32_t>(cx) * 73856093u ^ static_cast<uint32_t>(cy) * 19349663u;
+        return h & m_bucketMask;
+    }
+};
@@ -0,0 +1,40 @@
+#include "sprite_batch.h"
+#include "texture_manager.h"
+
+namespace {
+    SDL_FColor getFallbackColor(SpriteId id) {
+        switch (id) {
+            case SpriteId::PLAYER_HEALTH_ITEM:
+                return {0.0f, 1.0f, 0.0f, 1.0f};
+            case SpriteId::WORLD_HEALTH_ITEM:
+                return {1.0f, 1.0f, 0.0f, 1.0f};
+            default:
+                return {1.0f, 0.0f, 1.0f, 1.0f};
+        }
+    }
+}
+
+void SpriteBatch::draw(SpriteId id, const SDL_FRect& dst, bool flipX, Uint8 alpha) {
+    const TextureManager& textures = TextureManager::getInstance();
+    float a = alpha / 255.0f;
+
+    if (!textures.hasSprite(id)) {
+        SDL_FColor color = getFallbackColor(id);
+        color.a *= a;
+        m_batch.addQuad(dst, textures.getWhiteUV(), color);
+        return;
+    }
+
+    SDL_FRect uv = textures.getSpriteUV(id);
+    if (flipX) {
+        // run u backwards across the quad
+        uv.x += uv.w;
+        uv.w = -uv.w;
+    }
+    m_batch.addQuad(dst, uv, {1.0f, 1.0f, 1.0f, a});
+}
+
+void SpriteBatch::flush(SDL_Renderer* renderer) {
+    // without an atlas everything queued is a fallback rect, which draws fine untextured
+    m_batch.flush(renderer, TextureManager::getInstance().getAtlas());
+}
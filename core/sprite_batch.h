@@ -0,0 +1,21 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include "config.h"
+#include "geometry_batch.h"
+
+// sprites queued over a frame and drawn from the TextureManager atlas with one
+// SDL_RenderGeometry call. a sprite whose image failed to load is drawn as a
+// flat colored rect in the same call
+class SpriteBatch {
+public:
+    void reserve(size_t sprites) { m_batch.reserve(sprites); }
+
+    void draw(SpriteId id, const SDL_FRect& dst, bool flipX = false, Uint8 alpha = 255);
+
+    // draws everything queued so far, in the order it was queued, and empties the batch
+    void flush(SDL_Renderer* renderer);
+    void clear() { m_batch.clear(); }
+
+private:
+    GeometryBatch m_batch;
+};
@@ -0,0 +1,38 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+
+// fixed-size ring buffer from one producer thread to one consumer thread, with
+// no locks on either side. a full queue rejects the push instead of waiting, so
+// the producer never stalls. CAPACITY must be a power of two
+template <typename T, size_t CAPACITY>
+class SpscQueue {
+    static_assert(CAPACITY > 0 && (CAPACITY & (CAPACITY - 1)) == 0, "CAPACITY must be a power of two");
+
+public:
+    // producer side; false when full
+    bool push(const T& value) {
+        size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail - m_head.load(std::memory_order_acquire) == CAPACITY) return false;
+        m_slots[tail & MASK] = value;
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // consumer side; false when empty
+    bool pop(T& value) {
+        size_t head = m_head.load(std::memory_order_relaxed);
+        if (head == m_tail.load(std::memory_order_acquire)) return false;
+        value = m_slots[head & MASK];
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    static constexpr size_t MASK = CAPACITY - 1;
+
+    T m_slots[CAPACITY];
+    // the two ends on separate cache lines, so the threads don't contend for one
+    alignas(64) std::atomic<size_t> m_head{0}; // consumer only writes
+    alignas(64) std::atomic<size_t> m_tail{0}; // producer only writes
+};
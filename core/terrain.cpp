@@ -0,0 +1,303 @@
+#include "terrain.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    // noise wavelengths in px: broad hills and valleys, ridges on top, then surface detail
+    const float HILL_WAVELENGTH = 2400.0f;
+    const float RIDGE_WAVELENGTH = 640.0f;
+    const float DETAIL_WAVELENGTH = 160.0f;
+
+    const float INV_VERTEX_SPACING = 1.0f / Terrain::VERTEX_SPACING;
+
+    // splitmix64 finalizer over (seed, octave, lattice point) -> [0, 1)
+    float latticeValue(uint64_t seed, uint32_t octave, int32_t i) {
+        uint64_t z = seed ^ (static_cast<uint64_t>(octave) << 32) ^ static_cast<uint32_t>(i);
+        z += 0x9E3779B97F4A7C15ull;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        z ^= z >> 31;
+        return static_cast<float>(z >> 40) * (1.0f / 16777216.0f);
+    }
+}
+
+void Terrain::generate(uint64_t seed, float worldWidth, float worldHeight) {
+    m_seed = seed;
+    m_worldWidth = worldWidth;
+    m_worldHeight = worldHeight;
+
+    // segment s lives in chunk s / VERTICES_PER_CHUNK; the last vertex may sit past the world edge
+    m_vertexCount = std::max(2, static_cast<int>(std::ceil(worldWidth * INV_VERTEX_SPACING)) + 1);
+    m_chunkCount = (m_vertexCount - 2) / VERTICES_PER_CHUNK + 1;
+
+    m_chunks.clear();
+    m_firstChunk = 0;
+}
+
+void Terrain::update(float cameraX, float viewWidth) {
+    if (empty()) return;
+
+    // keep one chunk of margin on either side so the ground is ready before it scrolls in
+    int first = static_cast<int>(std::floor((cameraX - CHUNK_WIDTH) / CHUNK_WIDTH));
+    int last = static_cast<int>(std::floor((cameraX + viewWidth + CHUNK_WIDTH) / CHUNK_WIDTH));
+    first = std::clamp(first, 0, m_chunkCount - 1);
+    last = std::clamp(last, first, m_chunkCount - 1);
+
+    if (first == m_firstChunk && last - first + 1 == static_cast<int>(m_chunks.size())) return;
+
+    // keep chunks that are still in range, generate the ones that scrolled in
+    m_scratchChunks.clear();
+    m_scratchChunks.resize(last - first + 1);
+    for (int index = first; index <= last; ++index) {
+        Chunk& dst = m_scratchChunks[index - first];
+        int slot = index - m_firstChunk;
+        if (slot >= 0 && slot < static_cast<int>(m_chunks.size())) {
+            dst = std::move(m_chunks[slot]);
+        } else {
+            buildChunk(index, dst);
+        }
+    }
+    m_chunks.swap(m_scratchChunks);
+    m_firstChunk = first;
+}
+
+float Terrain::getGroundYAt(float x) const {
+    if (empty()) return m_worldHeight;
+    return m_worldHeight - depthAt(x);
+}
+
+void Terrain::getGroundYAt(const float* xs, float* out, size_t count) const {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = getGroundYAt(xs[i]);
+    }
+}
+
+float Terrain::getBeamEndX(float startX, float beamY, bool goingRight, float limitX) const {
+    const float edge = goingRight ? std::min(limitX, m_worldWidth) : std::max(limitX, 0.0f);
+    if (empty() || beamY <= 0.0f) return edge;
+
+    // above the highest possible peak the beam can't hit anything
+    if (beamY < m_worldHeight - MAX_DEPTH) return edge;
+
+    if (goingRight) {
+        int v = std::clamp(static_cast<int>(std::floor(startX * INV_VERTEX_SPACING)), 0, m_vertexCount - 2);
+        int lastVertex = std::clamp(static_cast<int>(std::ceil(edge * INV_VERTEX_SPACING)), v + 1, m_vertexCount - 1);
+        while (v < lastVertex) {
+            int c = v / VERTICES_PER_CHUNK;
+            if (beamY < m_worldHeight - chunkMaxDepth(c)) {
+                v = (c + 1) * VERTICES_PER_CHUNK; // beam clears this whole chunk
+                continue;
+            }
+
+            int chunkEnd = std::min((c + 1) * VERTICES_PER_CHUNK, lastVertex);
+            for (; v < chunkEnd; ++v) {
+                float x0 = vertexX(v);
+                float x1 = vertexX(v + 1);
+                float y0 = m_worldHeight - vertexDepth(v);
+                float y1 = m_worldHeight - vertexDepth(v + 1);
+
+                // if beam is above both points, it passes through
+                if (beamY < y0 && beamY < y1) continue;
+
+                // if beam is below or at both, it hits at segment start
+                if (beamY >= y0 && beamY >= y1) return std::min(std::max(startX, x0), edge);
+
+                // find X where the horizontal beam crosses the segment
+                float t = (beamY - y0) / (y1 - y0);
+                if (t >= 0.0f && t <= 1.0f) {
+                    float intersectX = x0 + t * (x1 - x0);
+                    if (intersectX >= startX) return std::min(intersectX, edge);
+                }
+            }
+        }
+        return edge;
+    }
+
+    // going left: same walk, backwards
+    int v = std::clamp(static_cast<int>(std::ceil(startX * INV_VERTEX_SPACING)), 1, m_vertexCount - 1);
+    int firstVertex = std::clamp(static_cast<int>(std::floor(edge * INV_VERTEX_SPACING)), 0, v - 1);
+    while (v > firstVertex) {
+        int c = (v - 1) / VERTICES_PER_CHUNK;
+        if (beamY < m_worldHeight - chunkMaxDepth(c)) {
+            v = c * VERTICES_PER_CHUNK;
+            continue;
+        }
+
+        int chunkStart = std::max(c * VERTICES_PER_CHUNK, firstVertex);
+        for (; v > chunkStart; --v) {
+            float x0 = vertexX(v - 1);
+            float x1 = vertexX(v);
+            float y0 = m_worldHeight - vertexDepth(v - 1);
+            float y1 = m_worldHeight - vertexDepth(v);
+
+            if (beamY < y0 && beamY < y1) continue;
+            if (beamY >= y0 && beamY >= y1) return std::max(std::min(startX, x1), edge);
+
+            float t = (beamY - y0) / (y1 - y0);
+            if (t >= 0.0f && t <= 1.0f) {
+                float intersectX = x0 + t * (x1 - x0);
+                if (intersectX <= startX) return std::max(intersectX, edge);
+            }
+        }
+    }
+    return edge;
+}
+
+SDL_FPoint Terrain::clipRay(float startX, float startY, float endX, float endY) const {
+    if (empty()) return {endX, endY};
+
+    // ray: from (startX, startY) to (endX, endY)
+    float rayDx = endX - startX;
+    float rayDy = endY - startY;
+    float bestT = 1.0f; // full length
+
+    // only the segments under the ray's x extent can cross it
+    int v0 = static_cast<int>(std::floor(std::min(startX, endX) * INV_VERTEX_SPACING));
+    int v1 = static_cast<int>(std::ceil(std::max(startX, endX) * INV_VERTEX_SPACING));
+    v0 = std::clamp(v0, 0, m_vertexCount - 2);
+    v1 = std::clamp(v1, v0 + 1, m_vertexCount - 1);
+
+    float y0 = m_worldHeight - vertexDepth(v0);
+    for (int v = v0; v < v1; ++v) {
+        float x0 = vertexX(v);
+        float x1 = vertexX(v + 1);
+        float y1 = m_worldHeight - vertexDepth(v + 1);
+
+        // landscape segment vector
+        float segDx = x1 - x0;
+        float segDy = y1 - y0;
+
+        // solve:
+        //      startX + t1*rayDx = x0 + t2*segDx
+        //      startY + t1*rayDy = y0 + t2*segDy
+        float denom = rayDx * segDy - rayDy * segDx;
+        if (std::abs(denom) >= 1e-6f) {
+            float t2 = (rayDx * (startY - y0) - rayDy * (startX - x0)) / denom;
+            if (t2 >= 0.0f && t2 <= 1.0f) {
+                float t1 = (std::abs(rayDx) < 1e-6f) ? (y0 + t2 * segDy - startY) / rayDy
+                                                      : (x0 + t2 * segDx - startX) / rayDx;
+                if (t1 >= 0.0f && t1 < bestT) bestT = t1;
+            }
+        }
+        y0 = y1;
+    }
+
+    return {
+        startX + bestT * rayDx,
+        startY + bestT * rayDy
+    };
+}
+
+void Terrain::getPoints(float x0, float x1, std::vector<SDL_FPoint>& out) const {
+    out.clear();
+    if (empty()) return;
+
+    x0 = std::clamp(x0, 0.0f, m_worldWidth);
+    x1 = std::clamp(x1, x0, m_worldWidth);
+    int v0 = static_cast<int>(std::floor(x0 * INV_VERTEX_SPACING));
+    int v1 = std::min(static_cast<int>(std::ceil(x1 * INV_VERTEX_SPACING)), m_vertexCount - 1);
+
+    for (int v = v0; v <= v1; ++v) {
+        float x = vertexX(v);
+        if (x >= m_worldWidth) {
+            // the last vertex can overhang the world; end the line exactly at the edge
+            out.push_back({m_worldWidth, m_worldHeight - depthAt(m_worldWidth)});
+            break;
+        }
+        out.push_back({x, m_worldHeight - vertexDepth(v)});
+    }
+}
+
+float Terrain::computeDepth(int vertex) const {
+    float x = vertexX(vertex);
+    float hills = valueNoise(x / HILL_WAVELENGTH, 0);
+    float ridge = 1.0f - std::abs(2.0f * valueNoise(x / RIDGE_WAVELENGTH, 1) - 1.0f); // sharp crests
+    float detail = valueNoise(x / DETAIL_WAVELENGTH, 2);
+
+    // ridges only stand tall where the hills already are, so valleys stay open
+    float shape = 0.85f * hills * (0.35f + 0.65f * ridge * ridge) + 0.15f * detail;
+    return MIN_DEPTH + (MAX_DEPTH - MIN_DEPTH) * shape;
+}
+
+float Terrain::valueNoise(float u, uint32_t octave) const {
+    float cell = std::floor(u);
+    float t = u - cell;
+    int32_t i = static_cast<int32_t>(cell);
+    float a = latticeValue(m_seed, octave, i);
+    float b = latticeValue(m_seed, octave, i + 1);
+    t = t * t * (3.0f - 2.0f * t); // smoothstep
+    return a + t * (b - a);
+}
+
+// value noise never leaves the range of the lattice values around it, so the
+// lattice points spanning [x0, x1] bound the noise over that stretch
+float Terrain::latticeMax(float x0, float x1, float wavelength, uint32_t octave, float& minOut) const {
+    int32_t first = static_cast<int32_t>(std::floor(x0 / wavelength));
+    int32_t last = static_cast<int32_t>(std::floor(x1 / wavelength)) + 1;
+    float maxValue = 0.0f;
+    minOut = 1.0f;
+    for (int32_t i = first; i <= last; ++i) {
+        float value = latticeValue(m_seed, octave, i);
+        maxValue = std::max(maxValue, value);
+        minOut = std::min(minOut, value);
+    }
+    return maxValue;
+}
+
+float Terrain::chunkMaxDepth(int index) const {
+    if (const Chunk* chunk = findChunk(index)) return chunk->maxDepth;
+
+    // same shape as computeDepth() with every octave at its largest possible value
+    float x0 = index * CHUNK_WIDTH;
+    float x1 = x0 + CHUNK_WIDTH;
+    float hillMin, ridgeMin;
+    float hills = latticeMax(x0, x1, HILL_WAVELENGTH, 0, hillMin);
+    float ridgeMax = latticeMax(x0, x1, RIDGE_WAVELENGTH, 1, ridgeMin);
+    float ridge = (ridgeMin <= 0.5f && ridgeMax >= 0.5f)
+        ? 1.0f // the noise passes through a crest somewhere in here
+        : std::max(1.0f - std::abs(2.0f * ridgeMin - 1.0f), 1.0f - std::abs(2.0f * ridgeMax - 1.0f));
+    float shape = 0.85f * hills * (0.35f + 0.65f * ridge * ridge) + 0.15f;
+    return MIN_DEPTH + (MAX_DEPTH - MIN_DEPTH) * shape;
+}
+
+void Terrain::buildChunk(int index, Chunk& chunk) const {
+    float depths[VERTICES_PER_CHUNK + 1];
+    int firstVertex = index * VERTICES_PER_CHUNK;
+    float maxDepth = 0.0f;
+    for (int i = 0; i <= VERTICES_PER_CHUNK; ++i) {
+        depths[i] = computeDepth(firstVertex + i);
+        maxDepth = std::max(maxDepth, depths[i]);
+    }
+
+    chunk.index = index;
+    chunk.depths.build(index * CHUNK_WIDTH, VERTEX_SPACING, depths, VERTICES_PER_CHUNK + 1);
+    chunk.maxDepth = maxDepth;
+}
+
+float Terrain::vertexDepth(int vertex) const {
+    int c = vertex / VERTICES_PER_CHUNK;
+    if (const Chunk* chunk = findChunk(c)) {
+        return chunk->depths.getSample(vertex - c * VERTICES_PER_CHUNK);
+    }
+    return computeDepth(vertex);
+}
+
+float Terrain::depthAt(float x) const {
+    x = std::clamp(x, 0.0f, m_worldWidth);
+    int c = std::min(static_cast<int>(x / CHUNK_WIDTH), m_chunkCount - 1);
+    if (const Chunk* chunk = findChunk(c)) {
+        return chunk->depths.sample(x);
+    }
+
+    // not streamed in: evaluate the two vertices directly, with the same arithmetic
+    // HeightField::sample uses so the answer doesn't depend on what's loaded
+    int firstVertex = c * VERTICES_PER_CHUNK;
+    float f = (x - c * CHUNK_WIDTH) * INV_VERTEX_SPACING;
+    if (f <= 0.0f) return computeDepth(firstVertex);
+    if (f >= static_cast<float>(VERTICES_PER_CHUNK)) return computeDepth(firstVertex + VERTICES_PER_CHUNK);
+    int i = static_cast<int>(f);
+    float t = f - static_cast<float>(i);
+    float a = computeDepth(firstVertex + i);
+    float b = computeDepth(firstVertex + i + 1);
+    return a + t * (b - a);
+}
@@ -0,0 +1,86 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <cstdint>
+#include <vector>
+#include "height_field.h"
+
+// seeded procedural landscape for arbitrarily wide worlds.
+//
+// the ground is a polyline with a vertex every VERTEX_SPACING px; each vertex's
+// depth (height above the bottom of the world) is a pure function of (seed, index)
+// built from value noise, so any part of the world can be evaluated on demand.
+// vertices near the camera are cached in CHUNK_WIDTH chunks that stream in ahead
+// of the camera and are evicted behind it - memory stays bounded, and every query
+// (ground height, beam/ray clipping, the visible polyline) only touches the
+// vertices it needs, so world width doesn't affect per-frame cost.
+//
+// depths rather than y values are stored so a window resize (which moves the
+// bottom of the world) doesn't require regenerating anything
+class Terrain {
+public:
+    static constexpr float VERTEX_SPACING = 32.0f;
+    static constexpr int VERTICES_PER_CHUNK = 32;
+    static constexpr float CHUNK_WIDTH = VERTEX_SPACING * VERTICES_PER_CHUNK;
+    static constexpr float MIN_DEPTH = 20.0f;  // lowest ground, px above the world bottom
+    static constexpr float MAX_DEPTH = 150.0f; // highest peaks
+
+    // starts a new landscape; drops every cached chunk
+    void generate(uint64_t seed, float worldWidth, float worldHeight);
+    void setWorldHeight(float worldHeight) { m_worldHeight = worldHeight; }
+    bool empty() const { return m_vertexCount == 0; }
+
+    // streams chunks in around the view and evicts the ones that fell behind
+    void update(float cameraX, float viewWidth);
+
+    // ground y at x (x is clamped to the world)
+    float getGroundYAt(float x) const;
+    void getGroundYAt(const float* xs, float* out, size_t count) const;
+
+    // where a horizontal beam fired from startX at beamY first meets the ground
+    // (or the world edge if it never does). the march stops at limitX, so callers
+    // that only care about a stretch of the beam pay only for that stretch
+    float getBeamEndX(float startX, float beamY, bool goingRight) const {
+        return getBeamEndX(startX, beamY, goingRight, goingRight ? m_worldWidth : 0.0f);
+    }
+    float getBeamEndX(float startX, float beamY, bool goingRight, float limitX) const;
+
+    // end of the ray start->end, pulled back to the first ground crossing
+    SDL_FPoint clipRay(float startX, float startY, float endX, float endY) const;
+
+    // ground polyline (world coordinates) covering [x0, x1], for rendering
+    void getPoints(float x0, float x1, std::vector<SDL_FPoint>& out) const;
+
+    size_t getLoadedChunkCount() const { return m_chunks.size(); }
+
+private:
+    struct Chunk {
+        int index = 0;
+        HeightField depths; // VERTICES_PER_CHUNK + 1 samples (the last one is shared with the next chunk)
+        float maxDepth = 0.0f;
+    };
+
+    uint64_t m_seed = 0;
+    float m_worldWidth = 0.0f;
+    float m_worldHeight = 0.0f;
+    int m_vertexCount = 0;
+    int m_chunkCount = 0;
+
+    // loaded chunks are always a contiguous run starting at m_firstChunk
+    int m_firstChunk = 0;
+    std::vector<Chunk> m_chunks;
+    std::vector<Chunk> m_scratchChunks;
+
+    float computeDepth(int vertex) const; // the noise function itself
+    float valueNoise(float u, uint32_t octave) const;
+    float latticeMax(float x0, float x1, float wavelength, uint32_t octave, float& minOut) const;
+    float chunkMaxDepth(int index) const; // exact when loaded, a cheap upper bound otherwise
+    void buildChunk(int index, Chunk& chunk) const;
+
+    const Chunk* findChunk(int index) const {
+        int slot = index - m_firstChunk;
+        return (slot >= 0 && slot < static_cast<int>(m_chunks.size())) ? &m_chunks[slot] : nullptr;
+    }
+    float vertexDepth(int vertex) const;
+    float vertexX(int vertex) const { return vertex * VERTEX_SPACING; }
+    float depthAt(float x) const;
+};
@@ -0,0 +1,164 @@
+#include "text_renderer.h"
+#include <algorithm>
+#include "font_manager.h"
+
+TextRenderer::~TextRenderer() {
+    shutdown();
+}
+
+bool TextRenderer::initialize(SDL_Renderer* renderer, const std::string& fontFile) {
+    shutdown();
+    for (int i = 0; i < SIZE_COUNT; ++i) {
+        int pixelSize = getPixelSize(static_cast<FontSize>(i));
+        auto font = FontManager::getInstance().getFont(fontFile, pixelSize);
+        if (!font) {
+            SDL_Log("TextRenderer: Failed to get font '%s' at size %d", fontFile.c_str(), pixelSize);
+            return false;
+        }
+        if (!buildPage(renderer, font.get(), m_pages[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void TextRenderer::shutdown() {
+    for (Page& page : m_pages) {
+        if (page.texture) {
+            SDL_DestroyTexture(page.texture);
+            page.texture = nullptr;
+        }
+        page.batch.clear();
+    }
+}
+
+float TextRenderer::drawText(const char* text, float x, float y, const SDL_Color& color, FontSize size) {
+    Page& page = m_pages[static_cast<int>(size)];
+    if (!page.texture) return 0.0f;
+
+    SDL_FColor fcolor = { color.r / 255.0f, color.g / 255.0f, color.b / 255.0f, color.a / 255.0f };
+    float penX = x;
+    int previous = -1;
+    for (const char* p = text; *p; ++p) {
+        int index = glyphIndex(*p);
+        if (previous >= 0) penX += page.kerning[previous * GLYPH_COUNT + index];
+
+        const Glyph& glyph = page.glyphs[index];
+        if (*p != ' ' && glyph.w > 0.0f) {
+            page.batch.addQuad({ penX, y, glyph.w, glyph.h }, glyph.uv, fcolor);
+        }
+        penX += glyph.advance;
+        previous = index;
+    }
+    return penX - x;
+}
+
+float TextRenderer::measureText(const char* text, FontSize size) const {
+    const Page& page = m_pages[static_cast<int>(size)];
+    float width = 0.0f;
+    int previous = -1;
+    for (const char* p = text; *p; ++p) {
+        int index = glyphIndex(*p);
+        if (previous >= 0) width += page.kerning[previous * GLYPH_COUNT + index];
+        width += page.glyphs[index].advance;
+        previous = index;
+    }
+    return width;
+}
+
+void TextRenderer::flush(SDL_Renderer* renderer) {
+    for (Page& page : m_pages) {
+        page.batch.flush(renderer, page.texture);
+    }
+}
+
+int TextRenderer::getPixelSize(FontSize size) {
+    switch (size) {
+        case FontSize::SMALL:
+            return 16;
+        case FontSize::MEDIUM:
+            return 24;
+        case FontSize::LARGE:
+            return 36;
+        case FontSize::GRANDELOCO:
+            return 52;
+    }
+    return 16;
+}
+
+bool TextRenderer::buildPage(SDL_Renderer* renderer, TTF_Font* font, Page& page) {
+    const SDL_Color white = {255, 255, 255, 255}; // tinted per quad through the vertex color
+
+    // rasterize every glyph and shelf-pack them into rows PAGE_WIDTH wide
+    SDL_Surface* glyphSurfaces[GLYPH_COUNT] = {};
+    SDL_Rect rects[GLYPH_COUNT] = {};
+    int penX = PAGE_PADDING;
+    int penY = PAGE_PADDING;
+    int shelfHeight = 0;
+    for (int i = 0; i < GLYPH_COUNT; ++i) {
+        Uint32 ch = static_cast<Uint32>(FIRST_GLYPH + i);
+        int advance = 0;
+        if (TTF_GetGlyphMetrics(font, ch, nullptr, nullptr, nullptr, nullptr, &advance)) {
+            page.glyphs[i].advance = static_cast<float>(advance);
+        }
+
+        SDL_Surface* surface = TTF_RenderGlyph_Blended(font, ch, white);
+        if (!surface) continue; // nothing to draw (e.g. glyph missing from the font)
+        glyphSurfaces[i] = surface;
+
+        if (penX + surface->w + PAGE_PADDING > PAGE_WIDTH) {
+            penX = PAGE_PADDING;
+            penY += shelfHeight + PAGE_PADDING;
+            shelfHeight = 0;
+        }
+        rects[i] = { penX, penY, surface->w, surface->h };
+        penX += surface->w + PAGE_PADDING;
+        shelfHeight = std::max(shelfHeight, surface->h);
+    }
+    int pageHeight = penY + shelfHeight + PAGE_PADDING;
+
+    SDL_Surface* atlas = SDL_CreateSurface(PAGE_WIDTH, pageHeight, SDL_PIXELFORMAT_ARGB8888);
+    if (!atlas) {
+        SDL_Log("TextRenderer: Failed to create atlas surface: %s", SDL_GetError());
+        for (SDL_Surface* surface : glyphSurfaces) SDL_DestroySurface(surface);
+        return false;
+    }
+
+    for (int i = 0; i < GLYPH_COUNT; ++i) {
+        SDL_Surface* surface = glyphSurfaces[i];
+        if (!surface) continue;
+        SDL_SetSurfaceBlendMode(surface, SDL_BLENDMODE_NONE); // copy alpha as-is
+        SDL_BlitSurface(surface, nullptr, atlas, &rects[i]);
+        SDL_DestroySurface(surface);
+
+        Glyph& glyph = page.glyphs[i];
+        glyph.w = static_cast<float>(rects[i].w);
+        glyph.h = static_cast<float>(rects[i].h);
+        glyph.uv = {
+            static_cast<float>(rects[i].x) / PAGE_WIDTH,
+            static_cast<float>(rects[i].y) / pageHeight,
+            glyph.w / PAGE_WIDTH,
+            glyph.h / pageHeight
+        };
+    }
+
+    page.texture = SDL_CreateTextureFromSurface(renderer, atlas);
+    SDL_DestroySurface(atlas);
+    if (!page.texture) {
+        SDL_Log("TextRenderer: Failed to create atlas texture: %s", SDL_GetError());
+        return false;
+    }
+    SDL_SetTextureBlendMode(page.texture, SDL_BLENDMODE_BLEND);
+
+    // pair kerning is looked up once here rather than per character per frame
+    page.kerning.assign(GLYPH_COUNT * GLYPH_COUNT, 0.0f);
+    for (int prev = 0; prev < GLYPH_COUNT; ++prev) {
+        for (int cur = 0; cur < GLYPH_COUNT; ++cur) {
+            int kerning = 0;
+            if (TTF_GetGlyphKerning(font, FIRST_GLYPH + prev, FIRST_GLYPH + cur, &kerning)) {
+                page.kerning[prev * GLYPH_COUNT + cur] = static_cast<float>(kerning);
+            }
+        }
+    }
+    return true;
+}
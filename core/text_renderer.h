@@ -0,0 +1,62 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <SDL3_ttf/SDL_ttf.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include "config.h"
+#include "geometry_batch.h"
+
+// bitmap-font text: every printable ASCII glyph of the font is rasterized once per
+// FontSize into an atlas texture (one page per size), and drawText() only appends
+// glyph quads to that page's batch. flush() submits each page with a single
+// SDL_RenderGeometry call, so any text - static or changing every frame - costs
+// a few vertices and no texture work
+class TextRenderer {
+public:
+    TextRenderer() = default;
+    ~TextRenderer();
+    TextRenderer(const TextRenderer&) = delete;
+    TextRenderer& operator=(const TextRenderer&) = delete;
+
+    bool initialize(SDL_Renderer* renderer, const std::string& fontFile);
+    void shutdown();
+
+    // queues the text with its top-left at (x, y); returns its width in px
+    float drawText(const char* text, float x, float y, const SDL_Color& color, FontSize size);
+    float measureText(const char* text, FontSize size) const;
+
+    // draws everything queued this frame; text always lands on top of what came before
+    void flush(SDL_Renderer* renderer);
+
+    static int getPixelSize(FontSize size);
+
+private:
+    static constexpr char FIRST_GLYPH = ' ';
+    static constexpr char LAST_GLYPH = '~';
+    static constexpr int GLYPH_COUNT = LAST_GLYPH - FIRST_GLYPH + 1;
+    static constexpr int PAGE_WIDTH = 512;
+    static constexpr int PAGE_PADDING = 1; // keeps linear filtering from bleeding neighbours in
+    static constexpr int SIZE_COUNT = static_cast<int>(FontSize::GRANDELOCO) + 1;
+
+    struct Glyph {
+        SDL_FRect uv;
+        float w = 0.0f;
+        float h = 0.0f;
+        float advance = 0.0f;
+    };
+
+    struct Page {
+        SDL_Texture* texture = nullptr;
+        Glyph glyphs[GLYPH_COUNT];
+        std::vector<float> kerning; // GLYPH_COUNT x GLYPH_COUNT, [previous * GLYPH_COUNT + current]
+        GeometryBatch batch;
+    };
+
+    Page m_pages[SIZE_COUNT];
+
+    bool buildPage(SDL_Renderer* renderer, TTF_Font* font, Page& page);
+    static int glyphIndex(char c) {
+        return (c < FIRST_GLYPH || c > LAST_GLYPH) ? ('?' - FIRST_GLYPH) : (c - FIRST_GLYPH);
+    }
+};
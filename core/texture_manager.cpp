@@ -1,43 +1,94 @@
 #include "texture_manager.h"
-#include <SDL3_image/SDL_image.h>
 #include <SDL3/SDL.h>
-#include <iostream>
+#include <algorithm>
 
 TextureManager& TextureManager::getInstance() {
     static TextureManager instance; //only created once (C++11)
     return instance;
 }
 
-std::shared_ptr<SDL_Texture> TextureManager::getTexture(const std::string& filepath, SDL_Renderer* renderer) {
-    auto it = m_textureCache.find(filepath);
-    if (it != m_textureCache.end()) {
-        // SDL_Log("TextureManager: Cache HIT for '%s'. Ref count: %ld", filepath.c_str(), it->second.use_count());
-        // return existing shared pointer
-        return it->second;
-    }
+bool TextureManager::buildAtlas(SDL_Renderer* renderer, SDL_Surface* const* images, int count) {
+    clearCache();
+
+    // shelf-pack the images into rows ATLAS_WIDTH wide, after a white block
+    SDL_Surface* surfaces[SPRITE_COUNT] = {};
+    SDL_Rect rects[SPRITE_COUNT] = {};
+    SDL_Rect whiteRect = { ATLAS_PADDING, ATLAS_PADDING, WHITE_SIZE, WHITE_SIZE };
+    int penX = whiteRect.x + WHITE_SIZE + ATLAS_PADDING;
+    int penY = ATLAS_PADDING;
+    int shelfHeight = WHITE_SIZE;
+    for (int i = 0; i < count; ++i) {
+        SDL_Surface* surface = images[i];
+        if (!surface) continue;
+        if (i >= SPRITE_COUNT || surface->w + 2 * ATLAS_PADDING > ATLAS_WIDTH) {
+            SDL_Log("TextureManager: Image %d doesn't fit the %d px atlas, skipped.", i, ATLAS_WIDTH);
+            SDL_DestroySurface(surface);
+            continue;
+        }
+        surfaces[i] = surface;
 
-    SDL_Texture* texture = IMG_LoadTexture(renderer, filepath.c_str());
-    if (!texture) {
-        SDL_Log("Failed to load texture '%s': %s", filepath.c_str(), SDL_GetError());
-        return nullptr; // return null shared_ptr if loading fails
+        if (penX + surface->w + ATLAS_PADDING > ATLAS_WIDTH) {
+            penX = ATLAS_PADDING;
+            penY += shelfHeight + ATLAS_PADDING;
+            shelfHeight = 0;
+        }
+        rects[i] = { penX, penY, surface->w, surface->h };
+        penX += surface->w + ATLAS_PADDING;
+        shelfHeight = std::max(shelfHeight, surface->h);
     }
+    int atlasHeight = penY + shelfHeight + ATLAS_PADDING;
 
-    // wrap raw pointer in a shared_ptr with custom deleter
-    auto sharedTexture = std::shared_ptr<SDL_Texture>(texture, SDL_Texture_Deleter{});
+    SDL_Surface* atlas = SDL_CreateSurface(ATLAS_WIDTH, atlasHeight, SDL_PIXELFORMAT_ARGB8888);
+    if (!atlas) {
+        SDL_Log("TextureManager: Failed to create atlas surface: %s", SDL_GetError());
+        for (SDL_Surface* surface : surfaces) SDL_DestroySurface(surface);
+        return false;
+    }
+    SDL_FillSurfaceRect(atlas, &whiteRect, SDL_MapSurfaceRGBA(atlas, 255, 255, 255, 255));
 
-    // store shared pointer in the cache
-    m_textureCache[filepath] = sharedTexture;
+    for (int i = 0; i < SPRITE_COUNT; ++i) {
+        SDL_Surface* surface = surfaces[i];
+        if (!surface) continue;
+        SDL_SetSurfaceBlendMode(surface, SDL_BLENDMODE_NONE); // copy alpha as-is
+        SDL_BlitSurface(surface, nullptr, atlas, &rects[i]);
+        SDL_DestroySurface(surface);
 
-    // SDL_Log("TextureManager: Cache MISS, LOADED texture '%s'. Ref count: %ld", filepath.c_str(), sharedTexture.use_count());
+        m_sprites[i].uv = {
+            static_cast<float>(rects[i].x) / ATLAS_WIDTH,
+            static_cast<float>(rects[i].y) / atlasHeight,
+            static_cast<float>(rects[i].w) / ATLAS_WIDTH,
+            static_cast<float>(rects[i].h) / atlasHeight
+        };
+        m_sprites[i].loaded = true;
+    }
+    m_whiteUV = {
+        (whiteRect.x + WHITE_SIZE * 0.5f) / ATLAS_WIDTH,
+        (whiteRect.y + WHITE_SIZE * 0.5f) / atlasHeight,
+        0.0f,
+        0.0f
+    };
 
-    return sharedTexture;
+    m_atlas = SDL_CreateTextureFromSurface(renderer, atlas);
+    SDL_DestroySurface(atlas);
+    if (!m_atlas) {
+        SDL_Log("TextureManager: Failed to create atlas texture: %s", SDL_GetError());
+        for (Sprite& sprite : m_sprites) sprite.loaded = false;
+        return false;
+    }
+    SDL_SetTextureBlendMode(m_atlas, SDL_BLENDMODE_BLEND);
+    SDL_Log("TextureManager: Packed %d sprites into a %dx%d atlas.", SPRITE_COUNT, ATLAS_WIDTH, atlasHeight);
+    return true;
 }
 
 void TextureManager::clearCache() {
-    SDL_Log("TextureManager: Clearing cache and destroying %zu textures.", m_textureCache.size());
-    m_textureCache.clear(); // will call the deleter for each texture
+    if (m_atlas) {
+        SDL_Log("TextureManager: Destroying sprite atlas.");
+        SDL_DestroyTexture(m_atlas);
+        m_atlas = nullptr;
+    }
+    for (Sprite& sprite : m_sprites) sprite = Sprite{};
 }
 
 TextureManager::~TextureManager() {
     clearCache(); //clean up all cached textures when manager is destroyed
-}
\ No newline at end of file
+}
@@ -1,11 +1,13 @@
 #pragma once
 #include <SDL3/SDL.h>
-#include <string>
-#include <unordered_map>
-#include <memory>
+#include "config.h"
 
 struct SDL_Texture;
 
+// every sprite image (Config::Textures::SPRITE_FILES, decoded by AssetLoader)
+// shelf-packed into one atlas texture at startup. sprites are looked up by
+// SpriteId, so drawing one is an array index instead of a string hash, and all
+// of them can go out in a single geometry call (see SpriteBatch)
 class TextureManager {
 public:
     // delete copy constructor and assignment operator to enforce singleton
@@ -15,22 +17,34 @@ public:
     // get singleton instance
     static TextureManager& getInstance();
 
-    std::shared_ptr<SDL_Texture> getTexture(const std::string& filepath, SDL_Renderer* renderer);
+    // packs decoded images, indexed by SpriteId, and uploads the atlas; takes
+    // ownership of (and frees) the surfaces. null entries are images that failed to
+    // load, reported by hasSprite(). false only if the atlas itself couldn't be made
+    bool buildAtlas(SDL_Renderer* renderer, SDL_Surface* const* images, int count);
+
+    SDL_Texture* getAtlas() const { return m_atlas; }
+    bool hasSprite(SpriteId id) const { return m_sprites[static_cast<int>(id)].loaded; }
+    const SDL_FRect& getSpriteUV(SpriteId id) const { return m_sprites[static_cast<int>(id)].uv; }
+    // a point inside an opaque white block, for untextured quads in the same batch
+    const SDL_FRect& getWhiteUV() const { return m_whiteUV; }
 
     void clearCache();
 
 private:
-    TextureManager() = default; 
+    TextureManager() = default;
     ~TextureManager(); // handles SDL_DestroyTexture
 
-    std::unordered_map<std::string, std::shared_ptr<SDL_Texture>> m_textureCache;
-};
+    static constexpr int ATLAS_WIDTH = 256;
+    static constexpr int ATLAS_PADDING = 1; // keeps linear filtering from bleeding neighbours in
+    static constexpr int WHITE_SIZE = 3;    // sampled at its centre texel only
+    static constexpr int SPRITE_COUNT = static_cast<int>(SpriteId::COUNT);
 
-// helper
-struct SDL_Texture_Deleter {
-    void operator()(SDL_Texture* texture) const {
-        if (texture) {
-            SDL_DestroyTexture(texture);
-        }
-    }
-};
\ No newline at end of file
+    struct Sprite {
+        SDL_FRect uv = {0.0f, 0.0f, 0.0f, 0.0f}; // normalized atlas coordinates
+        bool loaded = false;
+    };
+
+    SDL_Texture* m_atlas = nullptr;
+    Sprite m_sprites[SPRITE_COUNT];
+    SDL_FRect m_whiteUV = {0.0f, 0.0f, 0.0f, 0.0f};
+};
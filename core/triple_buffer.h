@@ -0,0 +1,37 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+
+// hands the latest value from one writer thread to one reader thread without
+// either ever waiting on the other. the writer fills back() and publish()es it;
+// the reader acquire()s whatever was published last and reads front(). a slow
+// reader just skips the values it never got to. slots are reused, so values
+// that own storage (vectors) keep their capacity from one round to the next
+template <typename T>
+class TripleBuffer {
+public:
+    // writer side
+    T& back() { return m_slots[m_back]; }
+    void publish() {
+        uint8_t previous = m_middle.exchange(static_cast<uint8_t>(m_back | FRESH), std::memory_order_acq_rel);
+        m_back = previous & INDEX_MASK;
+    }
+
+    // reader side: true when a value newer than front() was picked up
+    bool acquire() {
+        if (!(m_middle.load(std::memory_order_relaxed) & FRESH)) return false;
+        uint8_t previous = m_middle.exchange(m_front, std::memory_order_acq_rel);
+        m_front = previous & INDEX_MASK;
+        return true;
+    }
+    const T& front() const { return m_slots[m_front]; }
+
+private:
+    static constexpr uint8_t INDEX_MASK = 0x3;
+    static constexpr uint8_t FRESH = 0x4; // set by publish(), cleared by acquire()
+
+    T m_slots[3];
+    uint8_t m_back = 0;  // writer only
+    uint8_t m_front = 1; // reader only
+    std::atomic<uint8_t> m_middle{2};
+};
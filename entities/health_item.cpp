@@ -3,15 +3,16 @@
 
 const float HealthItem::BLINK_DURATION = 0.2f;
 
-HealthItem::HealthItem(float x, float y, float w, float h, HealthItemType type, const std::string& textureKey)
-    : m_rect{x, y, w, h}, m_type(type), m_textureKey(textureKey), m_velocityY(50.0f), m_hitGround(false), m_blinking(false), m_blinkTimer(0.0f), m_blinkCount(0) 
+HealthItem::HealthItem(float x, float y, float w, float h, HealthItemType type, SpriteId spriteId, Rng& rng)
+    : m_rect{x, y, w, h}, m_previousPosition{x, y}, m_type(type), m_spriteId(spriteId), m_velocityY(50.0f), m_hitGround(false), m_blinking(false), m_blinkTimer(0.0f), m_blinkCount(0) 
     { 
-        m_doesStop = (std::rand() / (RAND_MAX + 1.0f)) < 0.25f; // ~25% chance
+        m_doesStop = rng.chance(0.25f); // ~25% chance
         if(m_doesStop)             
-            m_randomStopY = 200 + (std::rand() % 101);// random between 200 and 300   
+            m_randomStopY = rng.range(200, 300);// random between 200 and 300   
     }
 
 void HealthItem::update(float deltaTime) {
+    m_previousPosition = { m_rect.x, m_rect.y };
     if (m_blinking) {
         m_blinkTimer += deltaTime;
         if (m_blinkTimer >= BLINK_DURATION) {
@@ -58,7 +59,3 @@ void HealthItem::startBlinking() {
     m_blinkTimer = 0.0f;
     m_blinkCount = 0;
 }
-
-const std::string& HealthItem::getTextureKey() const {
-    return m_textureKey;
-}
\ No newline at end of file
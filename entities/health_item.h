@@ -1,6 +1,7 @@
 #pragma once
 #include <SDL3/SDL.h>
-#include <string>
+#include "../core/config.h"
+#include "../core/random.h"
 
 enum class HealthItemType {
     PLAYER,
@@ -9,10 +10,11 @@ enum class HealthItemType {
 
 class HealthItem {
 public:
-    HealthItem(float x, float y, float w, float h, HealthItemType type, const std::string& textureKey);
+    HealthItem(float x, float y, float w, float h, HealthItemType type, SpriteId spriteId, Rng& rng);
 
     void update(float deltaTime);
     SDL_FRect getBounds() const;
+    SDL_FPoint getPreviousPosition() const { return m_previousPosition; } // before the last update, for render interpolation
     HealthItemType getType() const;
     bool isAlive() const; // false after blinking finishes
     bool isBlinking() const; // for rendering
@@ -22,12 +24,13 @@ public:
     void startBlinking();
 
     static const float BLINK_DURATION;
-    const std::string& getTextureKey() const; 
+    SpriteId getSpriteId() const { return m_spriteId; }
 
 private:
     SDL_FRect m_rect;
+    SDL_FPoint m_previousPosition;
     HealthItemType m_type;
-    std::string m_textureKey;
+    SpriteId m_spriteId;
     float m_velocityY; // falling speed
     bool m_hitGround;
     bool m_blinking;
@@ -1,14 +1,12 @@
 #include "aggressive_opponent.h"
 #include <SDL3/SDL.h>
-#include <SDL3_image/SDL_image.h>
 #include <cmath>
 #include <algorithm>
-#include "../particle.h"
-#include "../../core/texture_manager.h"
+#include "../particle_system.h"
 #include "../../core/game.h" 
 
-AggressiveOpponent::AggressiveOpponent(float x, float y, float w, float h) 
-    : BaseOpponent(x, y, w, h) {
+AggressiveOpponent::AggressiveOpponent(float x, float y, float w, float h, uint64_t seed) 
+    : BaseOpponent(x, y, w, h, seed) {
     m_lifetime = 0.0f;
     m_speed = 70.0f;
     m_angularSpeed = 0.0f;
@@ -32,7 +30,7 @@ AggressiveOpponent::AggressiveOpponent(float x, float y, float w, float h)
     m_explosionConfig.size = 1.9f;
 }
 
-void AggressiveOpponent::update(float deltaTime, const SDL_FPoint& playerPos, float cameraX, const GameStateData& state) {
+void AggressiveOpponent::update(float deltaTime, const SDL_FPoint& playerPos, float cameraX, const GameStateData& state, std::vector<Projectile>& shots) {
     if (m_health <= 0) return;
     m_lifetime += deltaTime;
 
@@ -46,7 +44,7 @@ void AggressiveOpponent::update(float deltaTime, const SDL_FPoint& playerPos, fl
         speed = m_speed;
 
     // targeting inaccuracy
-    float targetX = playerPos.x + (static_cast<float>(rand() % 200) - 100.0f);
+    float targetX = playerPos.x + (static_cast<float>(m_rng.nextInt(200)) - 100.0f);
     float targetY = playerPos.y;
 
     // chase player position
@@ -66,7 +64,7 @@ void AggressiveOpponent::update(float deltaTime, const SDL_FPoint& playerPos, fl
     bool opponentVisible = isOnScreen(m_rect.x + m_rect.w/2, m_rect.y, cameraX, state.screenWidth);
 
     if (opponentVisible && m_fireTimer >= m_fireInterval) {
-        m_projectiles.emplace(
+        shots.emplace_back(
             m_rect.x + m_rect.w/2,
             m_rect.y + m_rect.h/2,
             targetX,
@@ -2,16 +2,18 @@
 #include "base_opponent.h"
 #include <vector>
 #include <memory>
-#include "../particle.h"
+#include "../particle_system.h"
 
 class AggressiveOpponent : public BaseOpponent {
 public:
-    AggressiveOpponent(float x, float y, float w, float h);
+    AggressiveOpponent(float x, float y, float w, float h, uint64_t seed);
     ~AggressiveOpponent() = default;
 
-    void update(float deltaTime, const SDL_FPoint& playerPos, float cameraX, const GameStateData& state) override;
+    static constexpr OpponentType TYPE = OpponentType::AGGRESSIVE;
 
-    const std::string& getTextureKey() const override { return Config::Textures::AGGRESSIVE_OPPONENT; }
+    void update(float deltaTime, const SDL_FPoint& playerPos, float cameraX, const GameStateData& state, std::vector<Projectile>& shots);
+
+    SpriteId getSpriteId() const { return SpriteId::AGGRESSIVE_OPPONENT; }
 
 private:
     float m_lifetime;
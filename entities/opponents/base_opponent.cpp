@@ -1,13 +1,11 @@
 #include "base_opponent.h"
 #include <SDL3/SDL.h>
-#include <SDL3_image/SDL_image.h>
 #include <cmath>
-#include "../../core/texture_manager.h"
-#include "../../core/sound_manager.h"
 
-BaseOpponent::BaseOpponent(float x, float y, float w, float h) 
-    : m_rect{x, y, w, h},
-      m_angle(0.0f), m_startX(x), m_health(3), m_fireTimer(0.0f)
+BaseOpponent::BaseOpponent(float x, float y, float w, float h, uint64_t seed) 
+    : m_rect{x, y, w, h}, m_previousPosition{x, y},
+      m_angle(0.0f), m_startX(x), m_health(3), m_fireTimer(0.0f),
+      m_rng(seed)
       {}
 
 void BaseOpponent::takeDamage(int damage) {
@@ -19,14 +17,6 @@ SDL_FRect BaseOpponent::getBounds() const {
     return m_rect;
 }
 
-plf::colony<Projectile>& BaseOpponent::getProjectiles() {
-    return m_projectiles;
-}
-
-const plf::colony<Projectile>& BaseOpponent::getProjectiles() const {
-    return m_projectiles;
-}
-
 const int& BaseOpponent::getScoreVal() const {
     return m_scoreVal;
 }
@@ -41,26 +31,23 @@ bool BaseOpponent::isOnScreen(float objX, float objY, float cameraX, int screenW
     return (objX >= screenMinX && objX <= screenMaxX);
 }
 
-void BaseOpponent::explode(plf::colony<Particle>& gameParticles) const {
-    MIX_Mixer* mixer = SoundManager::getInstance().getMixerInstance();
-    if (mixer) 
-        SoundManager::getInstance().playSound(Config::Sounds::OPPONENT_EXPLODE, mixer);
-
+void BaseOpponent::explode(ParticleSystem& gameParticles, Rng& fxRng) const {
     SDL_FPoint center = { m_rect.x + m_rect.w / 2.0f, m_rect.y + m_rect.h / 2.0f };
     const ExplosionConfig& cfg = m_explosionConfig;
+    gameParticles.reserve(cfg.numParticles);
 
     for (int i = 0; i < cfg.numParticles; ++i) {
         float baseAngle = (static_cast<float>(i) / cfg.numParticles) * 2.0f * M_PI;
-        float angle = baseAngle + (static_cast<float>(rand()) / RAND_MAX) * cfg.angleJitter;
-        float speed = cfg.speedMin + static_cast<float>(rand()) / RAND_MAX * (cfg.speedMax - cfg.speedMin);
+        float angle = baseAngle + fxRng.nextFloat() * cfg.angleJitter;
+        float speed = fxRng.range(cfg.speedMin, cfg.speedMax);
 
         float velX = cosf(angle) * speed;
         float velY = sinf(angle) * speed;
 
-        Uint8 r = static_cast<Uint8>(cfg.rMin + (rand() % (cfg.rMax - cfg.rMin + 1)));
-        Uint8 g = static_cast<Uint8>(cfg.gMin + (rand() % (cfg.gMax - cfg.gMin + 1)));
-        Uint8 b = static_cast<Uint8>(cfg.bMin + (rand() % (cfg.bMax - cfg.bMin + 1)));
+        Uint8 r = static_cast<Uint8>(fxRng.range(cfg.rMin, cfg.rMax));
+        Uint8 g = static_cast<Uint8>(fxRng.range(cfg.gMin, cfg.gMax));
+        Uint8 b = static_cast<Uint8>(fxRng.range(cfg.bMin, cfg.bMax));
 
-        gameParticles.emplace(center.x, center.y, velX, velY, r, g, b, cfg.life, cfg.size);
+        gameParticles.emit(center.x, center.y, velX, velY, r, g, b, cfg.life, cfg.size);
     }
 }
\ No newline at end of file
@@ -3,36 +3,48 @@
 #include <vector>
 #include <memory>
 #include "../projectile.h"
-#include "../particle.h" 
+#include "../particle_system.h" 
 #include "../../core/config.h"
+#include "../../core/random.h"
 #include "../../plf/plf_colony.h" 
 
 struct GameStateData; // forward declaration
 
+enum class OpponentType : uint8_t {
+    BASIC,
+    AGGRESSIVE,
+    SNIPER
+};
+
+// shared state and behaviour only: opponents are stored by value in per-type pools
+// (opponent_pools.h) and called through their concrete type, so there is no vtable.
+// each derived type provides update() and getSpriteId(). update() may run on a
+// worker thread: it only touches the opponent itself and appends shots to `shots`,
+// which the game merges into its shared projectile store afterwards
 class BaseOpponent {
 public:
-    BaseOpponent(float x, float y, float w, float h);
-    virtual ~BaseOpponent() = default;
+    // seed starts this opponent's own random stream (see m_rng)
+    BaseOpponent(float x, float y, float w, float h, uint64_t seed);
 
-    virtual void update(float deltaTime, const SDL_FPoint& playerPos, float cameraX, const GameStateData& state) = 0;
+    static constexpr bool DAMAGES_WORLD = false; // reaching the ground costs world health
 
     SDL_FRect getBounds() const;
+    // where it was at the end of the previous tick, for render interpolation
+    SDL_FPoint getPreviousPosition() const { return m_previousPosition; }
+    void storePreviousPosition() { m_previousPosition = { m_rect.x, m_rect.y }; }
 
     bool isAlive() const { return m_health > 0; }
     void takeDamage(int damage);
 
-    plf::colony<Projectile>& getProjectiles();
-    const plf::colony<Projectile>& getProjectiles() const;
-
     const int& getScoreVal() const;
 
-    virtual void explode(plf::colony<Particle>& gameParticles) const;
-
-    virtual const std::string& getTextureKey() const = 0;
+    void explode(ParticleSystem& gameParticles, Rng& fxRng) const;
 
     bool isOnScreen(float objX, float objY, float cameraX, int screenWidth) const;
 
 protected:
+    ~BaseOpponent() = default; // never owned through a BaseOpponent*
+
     struct ExplosionConfig {
         int numParticles = 200;
         float speedMin = 50.0f;
@@ -51,6 +63,7 @@ protected:
     ExplosionConfig m_explosionConfig;
 
     SDL_FRect m_rect;
+    SDL_FPoint m_previousPosition;
 
     float m_speed;
     float m_angle;
@@ -59,9 +72,12 @@ protected:
     float m_startX;
     int m_health;
 
-    plf::colony<Projectile> m_projectiles;
     float m_fireTimer;
     float m_fireInterval;
 
     int m_scoreVal;
+
+    // per-opponent stream instead of the game's shared one, so opponents can update
+    // on any thread, in any order, and still make the same choices
+    Rng m_rng;
 };
\ No newline at end of file
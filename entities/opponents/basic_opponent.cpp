@@ -1,13 +1,11 @@
 #include "basic_opponent.h"
-#include "../particle.h"
+#include "../particle_system.h"
 #include <SDL3/SDL.h>
-#include <SDL3_image/SDL_image.h>
 #include <cmath>
-#include <cstdlib>
 #include "../../core/game.h" 
 
-BasicOpponent::BasicOpponent(float x, float y, float w, float h) 
-    : BaseOpponent(x, y, w, h) {
+BasicOpponent::BasicOpponent(float x, float y, float w, float h, uint64_t seed) 
+    : BaseOpponent(x, y, w, h, seed) {
     m_speed = 30.0f;
     m_angularSpeed = 1.5f;
     m_oscillationAmplitude = 80.0f;
@@ -29,7 +27,7 @@ BasicOpponent::BasicOpponent(float x, float y, float w, float h)
     m_explosionConfig.size = 2.2f;
 }
 
-void BasicOpponent::update(float deltaTime, const SDL_FPoint& playerPos, float cameraX, const GameStateData& state) {
+void BasicOpponent::update(float deltaTime, const SDL_FPoint& playerPos, float cameraX, const GameStateData& state, std::vector<Projectile>& shots) {
     if (m_health <= 0) return;
 
     m_rect.y += m_speed * deltaTime;
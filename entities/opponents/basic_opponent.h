@@ -2,14 +2,17 @@
 #include "base_opponent.h"
 #include <vector>
 #include <memory>
-#include "../particle.h"
+#include "../particle_system.h"
 
 class BasicOpponent : public BaseOpponent {
 public:
-    BasicOpponent(float x, float y, float w, float h);
+    BasicOpponent(float x, float y, float w, float h, uint64_t seed);
     ~BasicOpponent() = default;
 
-    void update(float deltaTime, const SDL_FPoint& playerPos, float cameraX, const GameStateData& state) override;
+    static constexpr OpponentType TYPE = OpponentType::BASIC;
+    static constexpr bool DAMAGES_WORLD = true;
 
-    const std::string& getTextureKey() const override { return Config::Textures::BASIC_OPPONENT; }
+    void update(float deltaTime, const SDL_FPoint& playerPos, float cameraX, const GameStateData& state, std::vector<Projectile>& shots);
+
+    SpriteId getSpriteId() const { return SpriteId::BASIC_OPPONENT; }
 };
\ No newline at end of file
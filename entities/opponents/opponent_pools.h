@@ -0,0 +1,54 @@
+#pragma once
+#include "basic_opponent.h"
+#include "aggressive_opponent.h"
+#include "sniper_opponent.h"
+#include "../../plf/plf_colony.h"
+
+// all live opponents, stored by value with one colony per type. spawning reuses
+// colony slots instead of allocating, and each pool is walked in a type-homogeneous
+// batch with direct calls. colony elements never move, so pointers and iterators
+// stay valid until that opponent is erased
+struct OpponentPools {
+    plf::colony<BasicOpponent> basic;
+    plf::colony<AggressiveOpponent> aggressive;
+    plf::colony<SniperOpponent> sniper;
+
+    // fn(pool) once per pool; with a generic lambda every pool gets its own instantiation
+    template <typename Fn>
+    void forEachPool(Fn&& fn) {
+        fn(basic);
+        fn(aggressive);
+        fn(sniper);
+    }
+    template <typename Fn>
+    void forEachPool(Fn&& fn) const {
+        fn(basic);
+        fn(aggressive);
+        fn(sniper);
+    }
+
+    // fn(opponent) for every opponent, pool by pool
+    template <typename Fn>
+    void forEach(Fn&& fn) const {
+        forEachPool([&fn](const auto& pool) {
+            for (const auto& opponent : pool) fn(opponent);
+        });
+    }
+
+    // by address, for callers that only kept a BaseOpponent* (and the type)
+    void erase(OpponentType type, BaseOpponent* opponent) {
+        switch (type) {
+            case OpponentType::BASIC: basic.erase(basic.get_iterator(static_cast<BasicOpponent*>(opponent))); break;
+            case OpponentType::AGGRESSIVE: aggressive.erase(aggressive.get_iterator(static_cast<AggressiveOpponent*>(opponent))); break;
+            case OpponentType::SNIPER: sniper.erase(sniper.get_iterator(static_cast<SniperOpponent*>(opponent))); break;
+        }
+    }
+
+    size_t size() const { return basic.size() + aggressive.size() + sniper.size(); }
+    bool empty() const { return basic.empty() && aggressive.empty() && sniper.empty(); }
+    void clear() {
+        basic.clear();
+        aggressive.clear();
+        sniper.clear();
+    }
+};
@@ -1,19 +1,17 @@
 #include "sniper_opponent.h"
 #include <SDL3/SDL.h>
-#include <SDL3_image/SDL_image.h>
 #include <cmath>
 #include <algorithm>
-#include "../particle.h"
-#include "../../core/texture_manager.h"
+#include "../particle_system.h"
 #include "../../core/game.h" 
 
-SniperOpponent::SniperOpponent(float x, float y, float w, float h) 
-    : BaseOpponent(x, y, w, h) {
+SniperOpponent::SniperOpponent(float x, float y, float w, float h, uint64_t seed) 
+    : BaseOpponent(x, y, w, h, seed) {
     m_speed = 30.0f;
     m_angularSpeed = 0.8f;
     m_oscillationAmplitude = 60.0f;
     m_oscillationSpeed = 1.0f;
-    m_oscillationOffset = static_cast<float>(rand()) / RAND_MAX * 2.0f * M_PI;
+    m_oscillationOffset = m_rng.nextFloat() * 2.0f * M_PI;
     m_fireInterval = 4.0f;
     
     m_health = 1;
@@ -33,7 +31,7 @@ SniperOpponent::SniperOpponent(float x, float y, float w, float h)
     m_explosionConfig.size = 1.35f;
 }
 
-void SniperOpponent::update(float deltaTime, const SDL_FPoint& playerPos, float cameraX, const GameStateData& state) {
+void SniperOpponent::update(float deltaTime, const SDL_FPoint& playerPos, float cameraX, const GameStateData& state, std::vector<Projectile>& shots) {
     if (m_health <= 0) return;
 
     // simple movement
@@ -45,7 +43,7 @@ void SniperOpponent::update(float deltaTime, const SDL_FPoint& playerPos, float
     bool opponentVisible = isOnScreen(m_rect.x + m_rect.w/2, m_rect.y, cameraX, state.screenWidth);
     
     if (opponentVisible && m_fireTimer >= m_fireInterval) {
-        m_projectiles.emplace(
+        shots.emplace_back(
             m_rect.x + m_rect.w/2,
             m_rect.y + m_rect.h/2,
             playerPos.x,
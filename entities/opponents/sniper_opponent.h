@@ -2,16 +2,18 @@
 #include "base_opponent.h"
 #include <vector>
 #include <memory>
-#include "../particle.h"
+#include "../particle_system.h"
 
 class SniperOpponent : public BaseOpponent {
 public:
-    SniperOpponent(float x, float y, float w, float h);
+    SniperOpponent(float x, float y, float w, float h, uint64_t seed);
     ~SniperOpponent() = default;
 
-    void update(float deltaTime, const SDL_FPoint& playerPos, float cameraX, const GameStateData& state) override;
+    static constexpr OpponentType TYPE = OpponentType::SNIPER;
 
-    const std::string& getTextureKey() const override { return Config::Textures::SNIPER_OPPONENT; }
+    void update(float deltaTime, const SDL_FPoint& playerPos, float cameraX, const GameStateData& state, std::vector<Projectile>& shots);
+
+    SpriteId getSpriteId() const { return SpriteId::SNIPER_OPPONENT; }
 
 private:
     float m_oscillationSpeed;
@@ -0,0 +1,152 @@
+#include "particle_system.h"
+#include <algorithm>
+
+#if defined(__AVX__)
+    #include <immintrin.h>
+    #define PARTICLES_AVX
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define PARTICLES_SSE2
+#endif
+
+void ParticleSystem::emit(float x, float y, float velocityX, float velocityY, Uint8 r, Uint8 g, Uint8 b, float initialSize, float lifetime) {
+    if (m_count == m_x.size())
+        grow(std::max<size_t>(256, m_count * 2));
+
+    size_t i = m_count++;
+    m_x[i] = x;
+    m_y[i] = y;
+    m_vx[i] = velocityX;
+    m_vy[i] = velocityY;
+    m_age[i] = 0.0f;
+    m_lifetime[i] = lifetime;
+    m_alphaScale[i] = 255.0f * FADE_RATE / lifetime;
+    m_initialSize[i] = initialSize;
+    m_size[i] = initialSize;
+    m_r[i] = r;
+    m_g[i] = g;
+    m_b[i] = b;
+    m_alpha[i] = 255.0f * FADE_RATE;
+}
+
+void ParticleSystem::reserve(size_t count) {
+    if (m_count + count > m_x.size())
+        grow(std::max(m_count + count, m_x.size() * 2));
+}
+
+void ParticleSystem::update(float deltaTime) {
+    if (m_count == 0) return;
+    integrate(deltaTime, 0, m_count);
+    compact();
+}
+
+void ParticleSystem::grow(size_t capacity) {
+    m_x.resize(capacity);
+    m_y.resize(capacity);
+    m_vx.resize(capacity);
+    m_vy.resize(capacity);
+    m_age.resize(capacity);
+    m_lifetime.resize(capacity);
+    m_alphaScale.resize(capacity);
+    m_initialSize.resize(capacity);
+    m_size.resize(capacity);
+    m_r.resize(capacity);
+    m_g.resize(capacity);
+    m_b.resize(capacity);
+    m_alpha.resize(capacity);
+}
+
+// per particle:
+//   age  += dt
+//   size  = initialSize + age * GROW_RATE
+//   alpha = (lifetime - age) * alphaScale
+//   pos  += vel * dt - (size - initialSize) / 2   (keeps the growing quad centered)
+void ParticleSystem::integrate(float deltaTime, size_t begin, size_t end) {
+    float* x = m_x.data();
+    float* y = m_y.data();
+    const float* vx = m_vx.data();
+    const float* vy = m_vy.data();
+    float* age = m_age.data();
+    const float* lifetime = m_lifetime.data();
+    const float* alphaScale = m_alphaScale.data();
+    const float* initialSize = m_initialSize.data();
+    float* size = m_size.data();
+    float* alpha = m_alpha.data();
+
+    size_t i = begin;
+
+#if defined(PARTICLES_AVX)
+    const __m256 dt8 = _mm256_set1_ps(deltaTime);
+    const __m256 grow8 = _mm256_set1_ps(GROW_RATE);
+    const __m256 half8 = _mm256_set1_ps(0.5f);
+    for (; i + 8 <= end; i += 8) {
+        __m256 a = _mm256_add_ps(_mm256_loadu_ps(age + i), dt8);
+        __m256 growth = _mm256_mul_ps(a, grow8);
+        __m256 offset = _mm256_mul_ps(growth, half8);
+        _mm256_storeu_ps(age + i, a);
+        _mm256_storeu_ps(size + i, _mm256_add_ps(_mm256_loadu_ps(initialSize + i), growth));
+        _mm256_storeu_ps(alpha + i, _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(lifetime + i), a), _mm256_loadu_ps(alphaScale + i)));
+        __m256 dx = _mm256_sub_ps(_mm256_mul_ps(_mm256_loadu_ps(vx + i), dt8), offset);
+        __m256 dy = _mm256_sub_ps(_mm256_mul_ps(_mm256_loadu_ps(vy + i), dt8), offset);
+        _mm256_storeu_ps(x + i, _mm256_add_ps(_mm256_loadu_ps(x + i), dx));
+        _mm256_storeu_ps(y + i, _mm256_add_ps(_mm256_loadu_ps(y + i), dy));
+    }
+#elif defined(PARTICLES_SSE2)
+    const __m128 dt4 = _mm_set1_ps(deltaTime);
+    const __m128 grow4 = _mm_set1_ps(GROW_RATE);
+    const __m128 half4 = _mm_set1_ps(0.5f);
+    for (; i + 4 <= end; i += 4) {
+        __m128 a = _mm_add_ps(_mm_loadu_ps(age + i), dt4);
+        __m128 growth = _mm_mul_ps(a, grow4);
+        __m128 offset = _mm_mul_ps(growth, half4);
+        _mm_storeu_ps(age + i, a);
+        _mm_storeu_ps(size + i, _mm_add_ps(_mm_loadu_ps(initialSize + i), growth));
+        _mm_storeu_ps(alpha + i, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(lifetime + i), a), _mm_loadu_ps(alphaScale + i)));
+        __m128 dx = _mm_sub_ps(_mm_mul_ps(_mm_loadu_ps(vx + i), dt4), offset);
+        __m128 dy = _mm_sub_ps(_mm_mul_ps(_mm_loadu_ps(vy + i), dt4), offset);
+        _mm_storeu_ps(x + i, _mm_add_ps(_mm_loadu_ps(x + i), dx));
+        _mm_storeu_ps(y + i, _mm_add_ps(_mm_loadu_ps(y + i), dy));
+    }
+#endif
+
+    // scalar fallback / tail - same operations in the same order as the vector paths
+    for (; i < end; ++i) {
+        float a = age[i] + deltaTime;
+        float growth = a * GROW_RATE;
+        float offset = growth * 0.5f;
+        age[i] = a;
+        size[i] = initialSize[i] + growth;
+        alpha[i] = (lifetime[i] - a) * alphaScale[i];
+        x[i] = x[i] + (vx[i] * deltaTime - offset);
+        y[i] = y[i] + (vy[i] * deltaTime - offset);
+    }
+}
+
+// a particle is dead once its alpha would truncate to 0 (which also covers age >= lifetime)
+void ParticleSystem::compact() {
+    size_t i = 0;
+    while (i < m_count) {
+        if (m_alpha[i] >= 1.0f) {
+            ++i;
+            continue;
+        }
+
+        size_t last = --m_count;
+        if (i != last) {
+            m_x[i] = m_x[last];
+            m_y[i] = m_y[last];
+            m_vx[i] = m_vx[last];
+            m_vy[i] = m_vy[last];
+            m_age[i] = m_age[last];
+            m_lifetime[i] = m_lifetime[last];
+            m_alphaScale[i] = m_alphaScale[last];
+            m_initialSize[i] = m_initialSize[last];
+            m_size[i] = m_size[last];
+            m_r[i] = m_r[last];
+            m_g[i] = m_g[last];
+            m_b[i] = m_b[last];
+            m_alpha[i] = m_alpha[last];
+        }
+        // don't advance: the particle swapped into slot i still needs checking
+    }
+}
@@ -0,0 +1,69 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <cstddef>
+#include <vector>
+
+// structure-of-arrays particle storage.
+// every attribute lives in its own array so the per-tick integrate/grow/fade pass
+// runs as a straight SIMD loop (AVX, SSE2 or scalar - picked at compile time),
+// and dead particles are removed by swapping the last live one into their slot
+class ParticleSystem {
+public:
+    ParticleSystem() = default;
+
+    // same parameters (and defaults) the old Particle constructor took
+    void emit(float x, float y, float velocityX, float velocityY, Uint8 r, Uint8 g, Uint8 b, float initialSize = 2.0f, float lifetime = 0.2f);
+
+    // make room for `count` more particles up front (explosions emit hundreds at once)
+    void reserve(size_t count);
+
+    // integrate, grow and fade every particle, then compact out the dead ones
+    void update(float deltaTime);
+
+    // update() in two steps, for callers that split the first across threads.
+    // ranges must start at multiples of RANGE_ALIGNMENT so each particle takes the
+    // same (vector or scalar) path it would in one whole-array call
+    static constexpr size_t RANGE_ALIGNMENT = 8;
+    void integrate(float deltaTime, size_t begin, size_t end);
+    void compact();
+
+    void clear() { m_count = 0; }
+    size_t size() const { return m_count; }
+    bool empty() const { return m_count == 0; }
+
+    // getters for rendering state
+    float getX(size_t i) const { return m_x[i]; }
+    float getY(size_t i) const { return m_y[i]; }
+    float getCurrentSize(size_t i) const { return m_size[i]; }
+    Uint8 getR(size_t i) const { return m_r[i]; }
+    Uint8 getG(size_t i) const { return m_g[i]; }
+    Uint8 getB(size_t i) const { return m_b[i]; }
+    Uint8 getAlpha(size_t i) const { return static_cast<Uint8>(m_alpha[i]); }
+
+private:
+    static constexpr float GROW_RATE = 2.0f; // particle growth rate (size units per second)
+    static constexpr float FADE_RATE = 0.8f; // scales the starting alpha
+
+    size_t m_count = 0;
+
+    // position and velocity
+    std::vector<float> m_x;
+    std::vector<float> m_y;
+    std::vector<float> m_vx;
+    std::vector<float> m_vy;
+
+    // age, lifetime and size
+    std::vector<float> m_age;
+    std::vector<float> m_lifetime;
+    std::vector<float> m_alphaScale; // 255 * FADE_RATE / lifetime, so fading needs no divide
+    std::vector<float> m_initialSize;
+    std::vector<float> m_size;
+
+    // color (alpha is kept as float while fading, truncated when read)
+    std::vector<Uint8> m_r;
+    std::vector<Uint8> m_g;
+    std::vector<Uint8> m_b;
+    std::vector<float> m_alpha;
+
+    void grow(size_t capacity);
+};
@@ -3,8 +3,9 @@
 #include <vector>
 #include <memory>
 #include "projectile.h"
-#include "particle.h"
+#include "particle_system.h"
 #include "../core/config.h"
+#include "../core/random.h"
 #include "../plf/plf_colony.h"
 
 enum class Direction {
@@ -17,15 +18,17 @@ public:
     Player(float x, float y, float w, float h);
     ~Player() = default;
 
-    void update(float deltaTime, plf::colony<Particle>& particles);
+    void update(float deltaTime, ParticleSystem& particles, Rng& fxRng);
 
     SDL_FRect getBounds() const;
     SDL_FPoint getFrontCenter() const;
+    // where it was at the end of the previous tick, for render interpolation
+    SDL_FPoint getPreviousPosition() const { return m_previousPosition; }
+    void storePreviousPosition() { m_previousPosition = { m_rect.x, m_rect.y }; }
     void setPosition(float x, float y);
 
-    plf::colony<Projectile>& getProjectiles();
-
-    void shoot();
+    // adds a beam to the shared projectile store
+    void shoot(plf::colony<Projectile>& projectiles);
     bool isAlive() const { return m_health > 0; }
     void takeDamage(int damage) { m_health -= damage; if (m_health < 0) m_health = 0; }
     int getHealth() const { return m_health; }
@@ -43,17 +46,16 @@ public:
 
 private:
     SDL_FRect m_rect;
+    SDL_FPoint m_previousPosition;
     float m_speed;
     Direction m_facing;
 
-    plf::colony<Projectile> m_projectiles;
-
     int m_maxHealth;
     int m_health;
     float m_normalSpeed;
     float m_boostMultiplier;
     bool m_speedBoostActive;
 
-    void spawnBoosterParticles(plf::colony<Particle>& particles);
-    void spawnDefaultBoosterParticles(plf::colony<Particle>& particles);
+    void spawnBoosterParticles(ParticleSystem& particles, Rng& fxRng);
+    void spawnDefaultBoosterParticles(ParticleSystem& particles, Rng& fxRng);
 };
\ No newline at end of file
@@ -4,18 +4,20 @@
 // player projectile constructor shoots horizontally
 Projectile::Projectile(float spawnX, float spawnY, float direction, float speed)
     : m_spawnX(spawnX), m_spawnY(spawnY), m_rect{spawnX, spawnY, 2.0f, 2.0f}, // m_rect is a small hitbox
+      m_previousPosition{spawnX, spawnY},
       m_direction(direction), m_speed(speed), m_age(0.0f), m_lifetime(0.5f) { 
     // velocity based on direction
     m_velocity.x = m_direction * m_speed;
     m_velocity.y = 0.0f; // horizontal
     m_isHorizontal = true;
+    m_faction = Faction::PLAYER;
 }
 
 // opponent projectile constructor is for aimed shots
 Projectile::Projectile(float spawnX, float spawnY, float targetX, float targetY, float speed)
     : m_spawnX(spawnX), m_spawnY(spawnY),
-      m_rect{spawnX, spawnY, 4.0f, 4.0f},
-      m_speed(speed), m_age(0.0f), m_lifetime(0.5f) {
+      m_rect{spawnX, spawnY, 4.0f, 4.0f}, m_previousPosition{spawnX, spawnY},
+      m_speed(speed), m_age(0.0f), m_lifetime(0.5f), m_faction(Faction::OPPONENT) {
 
     float dx = targetX - spawnX;
     float dy = targetY - spawnY;
@@ -30,6 +32,7 @@ Projectile::Projectile(float spawnX, float spawnY, float targetX, float targetY,
 }
 
 void Projectile::update(float deltaTime) {
+    m_previousPosition = { m_rect.x, m_rect.y };
     m_age += deltaTime;
     m_rect.x += m_velocity.x * deltaTime;
     m_rect.y += m_velocity.y * deltaTime;
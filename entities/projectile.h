@@ -3,6 +3,12 @@
 #include "../core/config.h"
 #include <cmath>
 
+// who fired a projectile, i.e. what it can hit
+enum class Faction : uint8_t {
+    PLAYER,  // hits opponents
+    OPPONENT // hits the player
+};
+
 class Projectile {
 public:
     // for player: fire horizontally
@@ -12,9 +18,12 @@ public:
     Projectile(float spawnX, float spawnY, float targetX, float targetY, float speed);
     ~Projectile() = default;
 
+    Faction getFaction() const { return m_faction; }
+
     void update(float deltaTime);
 
     SDL_FRect getBounds() const; // just a hit box
+    SDL_FPoint getPreviousPosition() const { return m_previousPosition; } // before the last update, for render interpolation
 
     // for spawn position (to calculate beam start point)
     float getSpawnX() const { return m_spawnX; }
@@ -44,6 +53,7 @@ public:
 
 private:
     SDL_FRect m_rect;
+    SDL_FPoint m_previousPosition;
     SDL_FPoint m_velocity;
 
     // position where the projectile was fired
@@ -57,4 +67,5 @@ private:
     const float m_lifetime; // lifetime of the projectile
 
     bool m_isHorizontal = false; // true for player shots
+    Faction m_faction;
 };
\ No newline at end of file
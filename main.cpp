@@ -1,8 +1,16 @@
 #include "core/platform.h"
 #include "core/game.h"
+#include "core/config.h"
+#include "core/profiler.h"
+#include "core/input_recording.h"
+#include "core/job_system.h"
+#include <algorithm>
 #include <filesystem>
 #include <iostream>
 #include <ctime>
+#include <cstdlib>
+#include <cstring>
+#include <string>
 
 // void* operator new(std::size_t size) {
 //     std::cout << "Allocating " << size << " bytes\n";
@@ -13,6 +21,11 @@
 //     free(ptr);
 // }
 
+void printUsage(const char* exe) {
+    std::cout << "usage: " << exe << " [--seed N] [--world-width W] [--profile-csv PATH] [--record PATH | --replay PATH]\n"
+              << "       [--threads N] [--tick-rate N] [--max-catch-up N] [--fps-cap N] [--no-vsync]\n";
+}
+
 int main(int argc, char* argv[]) {
     try {
         // change working directory to the executable's directory
@@ -24,16 +37,98 @@ int main(int argc, char* argv[]) {
         std::cerr << "Failed to set working directory: " << e.what() << std::endl;
     }
 
-    std::srand(static_cast<unsigned>(std::time(nullptr))); // TODO:
+    // --seed N replays a specific game; otherwise seed from the clock
+    uint64_t seed = static_cast<uint64_t>(std::time(nullptr));
+    float worldWidth = Config::Game::WORLD_WIDTH;
+    std::string profilePath; // --profile-csv: per-frame phase timings written at exit (.json for JSON)
+    std::string recordPath;  // --record: per-tick input stream, replayable with --replay
+    std::string replayPath;
+    int threads = JobSystem::getDefaultWorkerCount(); // --threads: workers besides the simulation thread
+    FrameTiming timing; // --tick-rate, --max-catch-up, --fps-cap, --no-vsync
+    bool validArgs = true;
+    for (int i = 1; i < argc && validArgs; ++i) {
+        bool hasValue = i + 1 < argc;
+        if (std::strcmp(argv[i], "--no-vsync") == 0)
+            timing.vsync = false;
+        else if (std::strcmp(argv[i], "--seed") == 0 && hasValue)
+            seed = std::strtoull(argv[++i], nullptr, 10);
+        else if (std::strcmp(argv[i], "--world-width") == 0 && hasValue)
+            worldWidth = static_cast<float>(std::atof(argv[++i]));
+        else if (std::strcmp(argv[i], "--profile-csv") == 0 && hasValue)
+            profilePath = argv[++i];
+        else if (std::strcmp(argv[i], "--record") == 0 && hasValue)
+            recordPath = argv[++i];
+        else if (std::strcmp(argv[i], "--replay") == 0 && hasValue)
+            replayPath = argv[++i];
+        else if (std::strcmp(argv[i], "--threads") == 0 && hasValue)
+            threads = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--tick-rate") == 0 && hasValue)
+            timing.tickRate = std::max(1, std::atoi(argv[++i]));
+        else if (std::strcmp(argv[i], "--max-catch-up") == 0 && hasValue)
+            timing.maxCatchUpTicks = std::max(1, std::atoi(argv[++i]));
+        else if (std::strcmp(argv[i], "--fps-cap") == 0 && hasValue)
+            timing.frameCap = std::max(0, std::atoi(argv[++i]));
+        else
+            validArgs = false;
+    }
+    if (!validArgs || threads < 0) {
+        printUsage(argv[0]);
+        return -1;
+    }
 
-    Game sim;
+    // a replay brings its own seed, world and high score table
+    InputReplay replay;
+    if (!replayPath.empty()) {
+        if (!replay.open(replayPath))
+            return -1;
+        seed = replay.getHeader().seed;
+        worldWidth = replay.getHeader().worldWidth;
+        timing.tickRate = replay.getHeader().tickRate;
+    }
+    Profiler::getInstance().setTraceEnabled(!profilePath.empty());
+    std::cout << "Seed: " << seed << std::endl;
+
+    JobSystem jobs(threads);
+    Game sim(seed);
+    sim.setJobSystem(&jobs);
+    sim.setWorldWidth(worldWidth);
     Platform platform;
+    platform.setFrameTiming(timing);
+    platform.setJobSystem(&jobs);
 
     if (!platform.initialize()) 
         return -1;
-    
+
+    // spawn positions are drawn from [0, worldWidth - margin), so the world has to span at least the window
+    if (worldWidth < platform.getWindowWidth()) {
+        std::cerr << "--world-width " << worldWidth << " is narrower than the window (" << platform.getWindowWidth() << ")" << std::endl;
+        printUsage(argv[0]);
+        return -1;
+    }
+
+    sim.setSoundSink(&SoundManager::getInstance());
+
+    InputRecorder recorder;
+    if (!replayPath.empty()) {
+        sim.getState().highScores = replay.getHeader().highScores;
+        sim.setSaveHighScores(false);
+        platform.setInputReplay(&replay);
+    } else if (!recordPath.empty()) {
+        RecordingHeader header;
+        header.seed = seed;
+        header.worldWidth = worldWidth;
+        header.screenWidth = platform.getWindowWidth();
+        header.screenHeight = platform.getWindowHeight();
+        header.tickRate = timing.tickRate;
+        header.highScores = sim.getState().highScores;
+        if (recorder.open(recordPath, header))
+            platform.setInputRecorder(&recorder);
+    }
+
     platform.run(sim);
+    recorder.close();
 
     platform.shutdown();
+    if (!profilePath.empty()) Profiler::getInstance().writeTrace(profilePath);
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,62 @@
+// packs the game's assets into the one archive it maps at startup (see
+// core/asset_archive.h). run it from the directory holding assets/ (the repo
+// root or next to the built game); files keep the paths Config names them by
+#include "../core/asset_archive.h"
+#include "../core/config.h"
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct PackerOptions {
+    std::string outPath = Config::Assets::ARCHIVE;
+    std::vector<std::string> files; // empty: everything the game loads
+};
+
+void printUsage(const char* exe) {
+    std::cout << "usage: " << exe << " [--out PATH] [FILE...]\n";
+}
+
+bool parseArgs(int argc, char* argv[], PackerOptions& opts) {
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (std::strcmp(arg, "--out") == 0 && hasValue) {
+            opts.outPath = argv[++i];
+        } else if (std::strncmp(arg, "--", 2) == 0) {
+            return false;
+        } else {
+            opts.files.push_back(arg);
+        }
+    }
+    return !opts.outPath.empty();
+}
+
+// the same files AssetManifest::fromConfig() loads
+std::vector<std::string> gameFiles() {
+    std::vector<std::string> files;
+    for (const std::string& file : Config::Textures::SPRITE_FILES) files.push_back(file);
+    files.push_back(Config::Fonts::DEFAULT_FONT_FILE);
+    for (const std::string& file : Config::Sounds::SOUND_FILES) files.push_back(file);
+    return files;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    PackerOptions opts;
+    if (!parseArgs(argc, argv, opts)) {
+        printUsage(argv[0]);
+        return 2;
+    }
+    if (opts.files.empty()) opts.files = gameFiles();
+
+    if (!AssetArchive::write(opts.outPath, opts.files)) {
+        std::cerr << "failed to write " << opts.outPath << "\n";
+        return 1;
+    }
+    std::cout << "packed " << opts.files.size() << " files into " << opts.outPath << "\n";
+    return 0;
+}
@@ -0,0 +1,307 @@
+// microbenchmarks for the simulation hot paths under scripted stress scenarios.
+// prints JSON (ns/op, ticks/sec) so runs can be diffed and gated in CI
+#include "../core/game.h"
+#include "../core/config.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+// reaches the private Game passes the benchmarks time in isolation
+class GameBench {
+public:
+    explicit GameBench(Game& game) : m_game(game) {}
+    void checkCollisions() { m_game.checkCollisions(); }
+    void updateAndPruneParticles(float deltaTime) { m_game.updateAndPruneParticles(deltaTime); }
+    Rng& fxRng() { return m_game.m_fxRng; }
+
+private:
+    Game& m_game;
+};
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+const float FIXED_DELTA_TIME = 1.0f / 60.0f;
+const int SCREEN_WIDTH = 1280;
+const int SCREEN_HEIGHT = 720;
+const int WARMUP_TICKS = 30; // lets terrain, camera and booster trail settle before measuring
+
+struct BenchOptions {
+    uint64_t seed = 1;
+    int reps = 5;           // each benchmark reports the median and min over reps
+    int ticks = 600;        // full update ticks per rep
+    std::string filter;     // only scenarios whose name contains this
+    std::string outPath;    // JSON goes to stdout when empty
+    int threads = 0;        // job system workers besides the main thread
+};
+
+struct Scenario {
+    const char* name;
+    int opponentsPerType;
+    int explosions; // opponents blown up at once, right before measuring
+    bool boost;     // player holds boost (and keeps moving) the whole time
+};
+
+const Scenario SCENARIOS[] = {
+    { "baseline",        0,   0, false },
+    { "opponents_50",   50,   0, false },
+    { "opponents_200", 200,   0, false },
+    { "explosions_100", 10, 100, false },
+    { "boost",          10,   0, true  },
+    { "stress",        200, 200, true  },
+};
+
+struct Result {
+    std::string name;
+    long long ops = 0; // per rep
+    double medianNs = 0.0;
+    double minNs = 0.0;
+    bool endedEarly = false; // full update only: the game ended before the last rep finished
+};
+
+struct ScenarioRun {
+    const Scenario* scenario;
+    size_t particleCount = 0; // live particles when the particle pass starts
+    std::vector<Result> results;
+};
+
+void printUsage(const char* exe) {
+    std::cout << "usage: " << exe << " [--seed N] [--reps N] [--ticks N] [--filter NAME] [--out PATH] [--threads N]\n";
+}
+
+bool parseArgs(int argc, char* argv[], BenchOptions& opts) {
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (std::strcmp(arg, "--seed") == 0 && hasValue) {
+            opts.seed = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(arg, "--reps") == 0 && hasValue) {
+            opts.reps = std::atoi(argv[++i]);
+        } else if (std::strcmp(arg, "--ticks") == 0 && hasValue) {
+            opts.ticks = std::atoi(argv[++i]);
+        } else if (std::strcmp(arg, "--filter") == 0 && hasValue) {
+            opts.filter = argv[++i];
+        } else if (std::strcmp(arg, "--out") == 0 && hasValue) {
+            opts.outPath = argv[++i];
+        } else if (std::strcmp(arg, "--threads") == 0 && hasValue) {
+            opts.threads = std::atoi(argv[++i]);
+        } else {
+            return false;
+        }
+    }
+    return opts.reps > 0 && opts.ticks > 0 && opts.threads >= 0;
+}
+
+GameInput scenarioInput(const Scenario& scenario, long long tick) {
+    GameInput input{};
+    if (scenario.boost) {
+        input.boost = true;
+        // sweep back and forth so the camera (and terrain streaming) keeps moving
+        if ((tick / 240) % 2 == 0) input.moveRight = true;
+        else input.moveLeft = true;
+    }
+    return input;
+}
+
+// a fresh game in the PLAYING state with the scenario's load on screen
+std::unique_ptr<Game> buildScenario(const Scenario& scenario, uint64_t seed, JobSystem& jobs) {
+    auto game = std::make_unique<Game>(seed);
+    game->setSaveHighScores(false);
+    game->setJobSystem(&jobs);
+    auto& state = game->getState();
+    state.screenWidth = static_cast<float>(SCREEN_WIDTH);
+    state.screenHeight = static_cast<float>(SCREEN_HEIGHT);
+    game->startNewGame();
+
+    for (long long tick = 0; tick < WARMUP_TICKS; ++tick) {
+        game->handleInput(scenarioInput(scenario, tick), FIXED_DELTA_TIME);
+        game->update(FIXED_DELTA_TIME);
+    }
+
+    // spread opponents over the view and one screen either side of it
+    Rng rng(seed, 99);
+    float minX = std::max(0.0f, state.cameraX - state.screenWidth);
+    float maxX = std::min(state.worldWidth - 50.0f, state.cameraX + 2.0f * state.screenWidth);
+    float minY = static_cast<float>(Config::Game::HUD_HEIGHT) + 10.0f;
+    float maxY = state.worldHeight * 0.6f;
+    auto randomPoint = [&]() {
+        float x = rng.range(minX, maxX); // sequenced, unlike two calls in one argument list
+        return SDL_FPoint{ x, rng.range(minY, maxY) };
+    };
+    for (int i = 0; i < scenario.opponentsPerType; ++i) {
+        SDL_FPoint p = randomPoint();
+        state.opponents.basic.emplace(p.x, p.y, 40, 40, rng.next());
+        p = randomPoint();
+        state.opponents.aggressive.emplace(p.x, p.y, 45, 45, rng.next());
+        p = randomPoint();
+        state.opponents.sniper.emplace(p.x, p.y, 35, 35, rng.next());
+    }
+
+    // explosions are purely cosmetic, so blowing up stand-ins leaves the opponents alone
+    GameBench bench(*game);
+    for (int i = 0; i < scenario.explosions; ++i) {
+        SDL_FPoint p = randomPoint();
+        BasicOpponent standIn(p.x, p.y, 40, 40, 0);
+        standIn.explode(state.particles, bench.fxRng());
+    }
+    return game;
+}
+
+// runs `reps` timed repetitions of `ops` operations; setup runs untimed before each rep
+Result measure(const std::string& name, int reps, long long ops,
+               const std::function<void()>& setup, const std::function<void(long long)>& op) {
+    std::vector<double> samples;
+    for (int r = 0; r < reps; ++r) {
+        setup();
+        auto start = Clock::now();
+        for (long long i = 0; i < ops; ++i) op(i);
+        std::chrono::duration<double, std::nano> elapsed = Clock::now() - start;
+        samples.push_back(elapsed.count() / static_cast<double>(ops));
+    }
+    std::sort(samples.begin(), samples.end());
+
+    Result result;
+    result.name = name;
+    result.ops = ops;
+    result.medianNs = samples[samples.size() / 2];
+    result.minNs = samples.front();
+    return result;
+}
+
+volatile float g_sink; // keeps query results alive
+
+ScenarioRun runScenario(const Scenario& scenario, const BenchOptions& opts, JobSystem& jobs) {
+    ScenarioRun run;
+    run.scenario = &scenario;
+    std::vector<Result>& results = run.results;
+    std::unique_ptr<Game> game;
+    const long long QUERY_OPS = 100000;
+    const long long COLLISION_OPS = 200;
+    const int PARTICLE_REPS = 20; // per --reps; one restored pass per sample
+
+    // full tick: handleInput + update, with the player and world kept alive
+    long long ticksRun = 0;
+    Result update = measure("update", opts.reps, opts.ticks,
+        [&] { game = buildScenario(scenario, opts.seed, jobs); ticksRun = 0; },
+        [&](long long tick) {
+            auto& state = game->getState();
+            if (state.state != GameStateData::State::PLAYING) return;
+            state.worldHealth = state.maxWorldHealth;
+            if (state.player) state.player->restoreHealth();
+            game->handleInput(scenarioInput(scenario, WARMUP_TICKS + tick), FIXED_DELTA_TIME);
+            game->update(FIXED_DELTA_TIME);
+            ++ticksRun;
+        });
+    update.endedEarly = ticksRun < opts.ticks;
+    results.push_back(update);
+
+    // broadphase rebuild + narrow phase; hits only happen on the first call
+    results.push_back(measure("collisions", opts.reps, COLLISION_OPS,
+        [&] {
+            game = buildScenario(scenario, opts.seed, jobs);
+            GameBench(*game).checkCollisions();
+        },
+        [&](long long) { GameBench(*game).checkCollisions(); }));
+
+    // one particle pass over the scenario's particles (explosions + booster trail),
+    // restored before every sample since explosion particles only live a few ticks
+    ParticleSystem particleSnapshot;
+    game = buildScenario(scenario, opts.seed, jobs);
+    particleSnapshot = game->getState().particles;
+    run.particleCount = particleSnapshot.size();
+    results.push_back(measure("particles", opts.reps * PARTICLE_REPS, 1,
+        [&] { game->getState().particles = particleSnapshot; },
+        [&](long long) { GameBench(*game).updateAndPruneParticles(FIXED_DELTA_TIME); }));
+
+    // terrain queries against the streamed window around the camera
+    const Terrain& terrain = game->getState().terrain;
+    const auto& state = game->getState();
+    Rng rng(opts.seed, 7);
+    std::vector<float> xs(QUERY_OPS), ys(QUERY_OPS), ex(QUERY_OPS), ey(QUERY_OPS);
+    for (long long i = 0; i < QUERY_OPS; ++i) {
+        xs[i] = rng.range(state.cameraX, state.cameraX + state.screenWidth);
+        ys[i] = rng.range(static_cast<float>(Config::Game::HUD_HEIGHT), state.worldHeight);
+        ex[i] = xs[i] + rng.range(-400.0f, 400.0f);
+        ey[i] = ys[i] + rng.range(-400.0f, 400.0f);
+    }
+
+    results.push_back(measure("terrain.ground_y", opts.reps, QUERY_OPS, [] {},
+        [&](long long i) { g_sink = terrain.getGroundYAt(xs[i]); }));
+
+    results.push_back(measure("terrain.beam_end", opts.reps, QUERY_OPS, [] {},
+        [&](long long i) {
+            bool goingRight = (i & 1) != 0;
+            float limitX = goingRight ? xs[i] + state.screenWidth : xs[i] - state.screenWidth;
+            g_sink = terrain.getBeamEndX(xs[i], ys[i], goingRight, limitX);
+        }));
+
+    results.push_back(measure("terrain.clip_ray", opts.reps, QUERY_OPS, [] {},
+        [&](long long i) { g_sink = terrain.clipRay(xs[i], ys[i], ex[i], ey[i]).x; }));
+
+    return run;
+}
+
+void writeJson(std::ostream& out, const BenchOptions& opts, const std::vector<ScenarioRun>& runs) {
+    out << "{\n  \"seed\": " << opts.seed << ",\n  \"reps\": " << opts.reps << ",\n  \"threads\": " << opts.threads
+        << ",\n  \"screen\": [" << SCREEN_WIDTH << ", " << SCREEN_HEIGHT << "],\n  \"scenarios\": [";
+    for (size_t s = 0; s < runs.size(); ++s) {
+        const Scenario& scenario = *runs[s].scenario;
+        out << (s ? "," : "") << "\n    {\n      \"name\": \"" << scenario.name << "\""
+            << ",\n      \"opponents_per_type\": " << scenario.opponentsPerType
+            << ",\n      \"explosions\": " << scenario.explosions
+            << ",\n      \"boost\": " << (scenario.boost ? "true" : "false")
+            << ",\n      \"particles\": " << runs[s].particleCount
+            << ",\n      \"benchmarks\": {";
+        const auto& results = runs[s].results;
+        for (size_t r = 0; r < results.size(); ++r) {
+            const Result& result = results[r];
+            out << (r ? "," : "") << "\n        \"" << result.name << "\": { \"ns_per_op\": " << result.medianNs
+                << ", \"min_ns_per_op\": " << result.minNs << ", \"ops\": " << result.ops;
+            if (result.name == "update") {
+                out << ", \"ticks_per_sec\": " << (result.medianNs > 0.0 ? 1e9 / result.medianNs : 0.0)
+                    << ", \"ended_early\": " << (result.endedEarly ? "true" : "false");
+            }
+            out << " }";
+        }
+        out << "\n      }\n    }";
+    }
+    out << "\n  ]\n}\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    BenchOptions opts;
+    if (!parseArgs(argc, argv, opts)) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    JobSystem jobs(opts.threads);
+    std::vector<ScenarioRun> runs;
+    for (const Scenario& scenario : SCENARIOS) {
+        if (!opts.filter.empty() && std::string(scenario.name).find(opts.filter) == std::string::npos) continue;
+        std::cerr << "running " << scenario.name << "...\n";
+        runs.push_back(runScenario(scenario, opts, jobs));
+    }
+
+    if (opts.outPath.empty()) {
+        writeJson(std::cout, opts, runs);
+        return 0;
+    }
+    std::ofstream file(opts.outPath);
+    if (!file.is_open()) {
+        std::cerr << "failed to open '" << opts.outPath << "' for writing\n";
+        return 1;
+    }
+    writeJson(file, opts, runs);
+    return 0;
+}
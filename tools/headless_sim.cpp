@@ -0,0 +1,242 @@
+// headless soak-test driver: runs Game::handleInput/Game::update at a fixed timestep
+// with no window, renderer or mixer (Game gets no SoundSink, so audio costs nothing)
+#include "../core/game.h"
+#include "../core/config.h"
+#include "../core/profiler.h"
+#include "../core/input_recording.h"
+#include "../core/job_system.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <string>
+
+namespace {
+
+struct SimOptions {
+    double minutes = 10.0;     // simulated minutes to run
+    uint64_t seed = 1;
+    int screenWidth = 800;
+    int screenHeight = 600;
+    float worldWidth = Config::Game::WORLD_WIDTH;
+    std::string profilePath; // one trace row per tick
+    std::string replayPath;  // recorded session to re-run instead of the autopilot
+    int threads = JobSystem::getDefaultWorkerCount(); // results don't depend on this, only speed does
+    int tickRate = Config::Timing::TICK_RATE; // autopilot only; replays use the recorded rate
+};
+
+void printUsage(const char* exe) {
+    std::cout << "usage: " << exe << " [--minutes N] [--seed N] [--width W] [--height H] [--world-width W] [--profile-csv PATH] [--threads N] [--tick-rate N]\n"
+              << "       " << exe << " --replay PATH [--profile-csv PATH] [--threads N]\n";
+}
+
+bool parseArgs(int argc, char* argv[], SimOptions& opts) {
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (std::strcmp(arg, "--minutes") == 0 && hasValue) {
+            opts.minutes = std::atof(argv[++i]);
+        } else if (std::strcmp(arg, "--seed") == 0 && hasValue) {
+            opts.seed = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(arg, "--width") == 0 && hasValue) {
+            opts.screenWidth = std::atoi(argv[++i]);
+        } else if (std::strcmp(arg, "--height") == 0 && hasValue) {
+            opts.screenHeight = std::atoi(argv[++i]);
+        } else if (std::strcmp(arg, "--world-width") == 0 && hasValue) {
+            opts.worldWidth = static_cast<float>(std::atof(argv[++i]));
+        } else if (std::strcmp(arg, "--profile-csv") == 0 && hasValue) {
+            opts.profilePath = argv[++i];
+        } else if (std::strcmp(arg, "--replay") == 0 && hasValue) {
+            opts.replayPath = argv[++i];
+        } else if (std::strcmp(arg, "--threads") == 0 && hasValue) {
+            opts.threads = std::atoi(argv[++i]);
+        } else if (std::strcmp(arg, "--tick-rate") == 0 && hasValue) {
+            opts.tickRate = std::atoi(argv[++i]);
+        } else {
+            return false;
+        }
+    }
+    return opts.minutes > 0.0 && opts.screenWidth > 0 && opts.screenHeight > 0 && opts.worldWidth >= opts.screenWidth && opts.threads >= 0 && opts.tickRate > 0;
+}
+
+// simple autopilot: chase the nearest opponent horizontally, line up with it and keep firing
+GameInput scriptedInput(const GameStateData& state, long long tick) {
+    GameInput input{};
+    if (!state.player) return input;
+
+    SDL_FRect pb = state.player->getBounds();
+    float px = pb.x + pb.w / 2.0f;
+    float py = pb.y + pb.h / 2.0f;
+
+    float bestDist = std::numeric_limits<float>::max();
+    SDL_FPoint target = { px, py };
+    state.opponents.forEach([&](const BaseOpponent& o) {
+        if (!o.isAlive()) return;
+        SDL_FRect ob = o.getBounds();
+        float ox = ob.x + ob.w / 2.0f;
+        float dist = std::abs(ox - px);
+        if (dist < bestDist) {
+            bestDist = dist;
+            target = { ox, ob.y + ob.h / 2.0f };
+        }
+    });
+
+    // keep some distance so the beam has room to travel
+    const float standoff = 200.0f;
+    if (target.x < px - standoff) input.moveLeft = true;
+    else if (target.x > px + standoff) input.moveRight = true;
+    else if (target.x < px) input.moveRight = true;
+    else input.moveLeft = true;
+
+    if (target.y < py - 4.0f) input.moveUp = true;
+    else if (target.y > py + 4.0f) input.moveDown = true;
+
+    input.shoot = (tick % 6) < 3; // shooting is edge-triggered
+    input.boost = (tick / 120) % 4 == 0;
+    return input;
+}
+
+// feeds a session recorded with --record back through the game as fast as it will go;
+// the same binary on the same recording must finish with the same numbers every time
+int runReplay(const SimOptions& opts) {
+    InputReplay replay;
+    if (!replay.open(opts.replayPath)) return 1;
+    const RecordingHeader& header = replay.getHeader();
+
+    const float FIXED_DELTA_TIME = 1.0f / header.tickRate;
+    JobSystem jobs(opts.threads);
+    Game sim(header.seed);
+    sim.setJobSystem(&jobs);
+    sim.setWorldWidth(header.worldWidth);
+    sim.setSaveHighScores(false);
+    auto& state = sim.getState();
+    state.highScores = header.highScores;
+
+    Profiler& profiler = Profiler::getInstance();
+    profiler.setTraceEnabled(!opts.profilePath.empty());
+
+    long long ticks = 0;
+    int gamesPlayed = 0;
+    int lastScore = 0;
+    GameStateData::State previousState = state.state;
+    GameInput input;
+    int screenWidth = 0;
+    int screenHeight = 0;
+
+    auto startTime = std::chrono::steady_clock::now();
+    while (state.running && replay.next(input, screenWidth, screenHeight)) {
+        // same per-tick setup Platform::run does
+        state.screenWidth = static_cast<float>(screenWidth);
+        state.screenHeight = static_cast<float>(screenHeight);
+        if (state.state == GameStateData::State::PLAYING) state.worldHeight = state.screenHeight;
+
+        sim.handleInput(input, FIXED_DELTA_TIME);
+        sim.update(FIXED_DELTA_TIME);
+        profiler.endFrame();
+        ++ticks;
+
+        if (state.state != previousState) {
+            if (state.state == GameStateData::State::PLAYING) ++gamesPlayed;
+            if (state.state == GameStateData::State::GAME_OVER) lastScore = state.playerScore;
+            previousState = state.state;
+        }
+    }
+    std::chrono::duration<double> wall = std::chrono::steady_clock::now() - startTime;
+    double simSeconds = static_cast<double>(ticks) * FIXED_DELTA_TIME;
+    if (state.state == GameStateData::State::PLAYING) lastScore = state.playerScore;
+
+    std::cout << "replay:           " << opts.replayPath << "\n"
+              << "seed:             " << header.seed << "\n"
+              << "tick rate:        " << header.tickRate << "\n"
+              << "threads:          " << opts.threads << "\n"
+              << "ticks:            " << ticks << "\n"
+              << "simulated time:   " << simSeconds << " s\n"
+              << "wall time:        " << wall.count() << " s\n"
+              << "ticks/sec:        " << (wall.count() > 0.0 ? ticks / wall.count() : 0.0) << "\n"
+              << "sim speed:        " << (wall.count() > 0.0 ? simSeconds / wall.count() : 0.0) << "x realtime\n"
+              << "games played:     " << gamesPlayed << "\n"
+              << "last score:       " << lastScore << "\n"
+              << "world health:     " << state.worldHealth << "\n";
+
+    if (!opts.profilePath.empty() && !profiler.writeTrace(opts.profilePath)) {
+        return 1;
+    }
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    SimOptions opts;
+    if (!parseArgs(argc, argv, opts)) {
+        printUsage(argv[0]);
+        return 1;
+    }
+    if (!opts.replayPath.empty()) {
+        return runReplay(opts);
+    }
+
+    const float FIXED_DELTA_TIME = 1.0f / opts.tickRate;
+    const long long totalTicks = static_cast<long long>(opts.minutes * 60.0 * opts.tickRate);
+
+    JobSystem jobs(opts.threads);
+    Game sim(opts.seed);
+    sim.setJobSystem(&jobs);
+    sim.setWorldWidth(opts.worldWidth);
+    auto& state = sim.getState();
+    state.screenWidth = static_cast<float>(opts.screenWidth);
+    state.screenHeight = static_cast<float>(opts.screenHeight);
+    state.worldHeight = state.screenHeight;
+
+    int gamesPlayed = 0;
+    long long scoreTotal = 0;
+    int bestScore = 0;
+
+    Profiler& profiler = Profiler::getInstance();
+    profiler.setTraceEnabled(!opts.profilePath.empty());
+
+    auto startTime = std::chrono::steady_clock::now();
+
+    sim.startNewGame();
+    gamesPlayed = 1;
+    for (long long tick = 0; tick < totalTicks; ++tick) {
+        if (state.state != GameStateData::State::PLAYING) {
+            scoreTotal += state.playerScore;
+            bestScore = std::max(bestScore, state.playerScore);
+            // restart directly so no high score entry (and no file write) happens
+            state.waitingForHighScore = false;
+            sim.startNewGame();
+            ++gamesPlayed;
+        }
+
+        GameInput input = scriptedInput(state, tick);
+        sim.handleInput(input, FIXED_DELTA_TIME);
+        sim.update(FIXED_DELTA_TIME);
+        profiler.endFrame();
+    }
+    scoreTotal += state.playerScore;
+    bestScore = std::max(bestScore, state.playerScore);
+
+    std::chrono::duration<double> wall = std::chrono::steady_clock::now() - startTime;
+    double simSeconds = static_cast<double>(totalTicks) * FIXED_DELTA_TIME;
+
+    std::cout << "seed:             " << opts.seed << "\n"
+              << "tick rate:        " << opts.tickRate << "\n"
+              << "threads:          " << opts.threads << "\n"
+              << "ticks:            " << totalTicks << "\n"
+              << "simulated time:   " << simSeconds << " s\n"
+              << "wall time:        " << wall.count() << " s\n"
+              << "ticks/sec:        " << (wall.count() > 0.0 ? totalTicks / wall.count() : 0.0) << "\n"
+              << "sim speed:        " << (wall.count() > 0.0 ? simSeconds / wall.count() : 0.0) << "x realtime\n"
+              << "games played:     " << gamesPlayed << "\n"
+              << "average score:    " << (gamesPlayed > 0 ? scoreTotal / gamesPlayed : 0) << "\n"
+              << "best score:       " << bestScore << "\n";
+
+    if (!opts.profilePath.empty() && !profiler.writeTrace(opts.profilePath)) {
+        return 1;
+    }
+    return 0;
+}